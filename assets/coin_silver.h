@@ -1,12 +0,0 @@
-
-#ifndef coin_silver_H
-#define coin_silver_H
-
-const GLfloat coin_silver_vertices[] = {-0.298597,0.05265,0.030907,-0.298597,0.05265,0.033463,-0.262582,0.151601,0.033463,-0.262582,0.151601,0.030907,-0.262582,0.151601,0.033463,-0.194896,0.232267,0.033463,-0.194896,0.232267,0.030907,-0.194896,0.232267,0.033463,-0.103702,0.284917,0.033463,-0.103702,0.284917,0.030907,-0.103702,0.284917,0.033463,-1e-06,0.303203,0.033463,-1e-06,0.303203,0.030907,-1e-06,0.303203,0.033463,0.103701,0.284917,0.033463,0.103701,0.284917,0.030907,0.103701,0.284917,0.033463,0.194894,0.232267,0.033463,0.194894,0.232267,0.030907,0.194894,0.232267,0.033463,0.262581,0.151601,0.033463,0.262581,0.151601,0.030907,0.262581,0.151601,0.033463,0.298596,0.05265,0.033463,0.298596,0.05265,0.030907,0.298596,0.05265,0.033463,0.298596,-0.052651,0.033463,0.298596,-0.052651,0.030907,0.298596,-0.052651,0.033463,0.262581,-0.151602,0.033463,0.262581,-0.151602,0.030907,0.262581,-0.151602,0.033463,0.194895,-0.232267,0.033463,0.194895,-0.232267,0.030907,0.194895,-0.232267,0.033463,0.103701,-0.284918,0.033463,0.103701,-0.284918,0.030907,0.103701,-0.284918,0.033463,-0,-0.303203,0.033463,-0,-0.303203,0.030907,-0,-0.303203,0.033463,-0.103702,-0.284918,0.033463,-0.262582,-0.151602,0.030907,-0.262582,-0.151602,0.033463,-0.298597,-0.052651,0.033463,-0.103702,-0.284918,0.030907,-0.103702,-0.284918,0.033463,-0.194895,-0.232267,0.033463,-0.185844,0.221479,0.030907,-0.250387,0.14456,0.035466,-0.250387,0.14456,0.030907,0.286999,0.050605,0.037737,0.258823,0.149432,0.037737,0.252382,0.145713,0.037737,-0.250386,-0.144561,0.030907,-0.185844,-0.22148,0.035466,-0.185844,-0.22148,0.030907,-0.287,-0.050606,0.037737,-0.294324,0.051897,0.037737,-0.294324,-0.051897,0.037737,0.187325,-0.223246,0.037737,0.102217,-0.280841,0.037737,0.192106,-0.228943,0.037737,-0.187326,0.223246,0.037737,-0.102218,0.28084,0.037737,-0.192107,0.228943,0.037737,-0.252383,-0.145714,0.037737,-0.192106,-0.228943,0.037737,-0.187326,-0.223246,0.037737,0.192105,0.228943,0.037737,0.187325,0.223246,0.037737,0.258823,-0.149432,0.037737,0.252382,-0.145714,0.037737,-0.258824,0.149432,0.037737,-0.252383,0.145713,0.037737,-0.284729,0.050205,0.030907,-0.284729,-0.050206,0.035466,-0.284729,-0.050206,0.030907,-0.250387,0.14456,0.030907,-0.284729,0.050205,0.035466,-0.284729,0.050205,0.030907,-0.098886,0.271685,0.030907,-0.185844,0.221479,0.035466,-0.185844,0.221479,0.030907,-1e-06,0.289121,0.030907,-0.098886,0.271685,0.035466,-0.098886,0.271685,0.030907,0.098885,0.271685,0.030907,-1e-06,0.289121,0.035466,-1e-06,0.289121,0.030907,0.185843,0.221479,0.030907,0.098885,0.271685,0.035466,0.098885,0.271685,0.030907,0.250385,0.14456,0.030907,0.185843,0.221479,0.035466,0.185843,0.221479,0.030907,0.284728,0.050205,0.030907,0.250385,0.14456,0.035466,0.250385,0.14456,0.030907,0.284728,-0.050206,0.030907,0.284728,0.050205,0.035466,0.284728,0.050205,0.030907,0.250386,-0.144561,0.030907,0.284728,-0.050206,0.035466,0.284728,-0.050206,0.030907,0.185843,-0.22148,0.030907,0.250386,-0.144561,0.035466,0.250386,-0.144561,0.030907,0.098885,-0.271685,0.030907,0.185843,-0.22148,0.035466,0.185843,-0.22148,0.030907,-0,-0.289121,0.030907,0.098885,-0.271685,0.035466,0.098885,-0.271685,0.030907,-0.098885,-0.271685,0.030907,-0,-0.289121,0.035466,-0,-0.289121,0.030907,-0.194895,-0.232267,0.030907,-0.194895,-0.232267,0.033463,-0.262582,-0.151602,0.033463,-0.185844,-0.22148,0.030907,-0.098885,-0.271685,0.035466,-0.098885,-0.271685,0.030907,-1e-06,0.291426,0.037737,-0.099674,0.273851,0.037737,0.099674,-0.273852,0.037737,-0,-0.298864,0.037737,0.294323,-0.051897,0.037737,0.294323,0.051897,0.037737,0.099673,0.273851,0.037737,-1e-06,0.298864,0.037737,-0.099674,-0.273852,0.037737,-0,-0.291427,0.037737,-0.287,0.050606,0.037737,0.286999,-0.050606,0.037737,0.102217,0.28084,0.037737,-0.102218,-0.280841,0.037737,-0.252383,-0.145714,0.037737,-0.284729,-0.050206,0.035466,-0.287,-0.050606,0.037737,-0.287,-0.050606,0.037737,-0.284729,0.050205,0.035466,-0.287,0.050606,0.037737,-0.287,0.050606,0.037737,-0.250387,0.14456,0.035466,-0.252383,0.145713,0.037737,-0.187326,0.223246,0.037737,-0.250387,0.14456,0.035466,-0.185844,0.221479,0.035466,-0.187326,0.223246,0.037737,-0.098886,0.271685,0.035466,-0.099674,0.273851,0.037737,-0.099674,0.273851,0.037737,-1e-06,0.289121,0.035466,-1e-06,0.291426,0.037737,0.099673,0.273851,0.037737,-1e-06,0.289121,0.035466,0.098885,0.271685,0.035466,0.187325,0.223246,0.037737,0.098885,0.271685,0.035466,0.185843,0.221479,0.035466,0.252382,0.145713,0.037737,0.185843,0.221479,0.035466,0.250385,0.14456,0.035466,0.252382,0.145713,0.037737,0.284728,0.050205,0.035466,0.286999,0.050605,0.037737,0.286999,0.050605,0.037737,0.284728,-0.050206,0.035466,0.286999,-0.050606,0.037737,0.252382,-0.145714,0.037737,0.284728,-0.050206,0.035466,0.250386,-0.144561,0.035466,0.187325,-0.223246,0.037737,0.250386,-0.144561,0.035466,0.185843,-0.22148,0.035466,0.187325,-0.223246,0.037737,0.098885,-0.271685,0.035466,0.099674,-0.273852,0.037737,0.099674,-0.273852,0.037737,-0,-0.289121,0.035466,-0,-0.291427,0.037737,-0,-0.291427,0.037737,-0.098885,-0.271685,0.035466,-0.099674,-0.273852,0.037737,-0.187326,-0.223246,0.037737,-0.098885,-0.271685,0.035466,-0.185844,-0.22148,0.035466,-0.252383,-0.145714,0.037737,-0.185844,-0.22148,0.035466,-0.250386,-0.144561,0.035466,-0.284729,-0.050206,0.030907,-0.250386,-0.144561,0.035466,-0.250386,-0.144561,0.030907,-0.298597,-0.052651,0.033463,-0.262078,-0.151311,0.0356,-0.298024,-0.05255,0.0356,-0.262078,-0.151311,0.0356,-0.29646,-0.052274,0.037164,-0.298024,-0.05255,0.0356,-0.260703,-0.150517,0.037164,-0.294324,-0.051897,0.037737,-0.29646,-0.052274,0.037164,-0.298597,0.05265,0.033463,-0.298024,-0.05255,0.0356,-0.298025,0.05255,0.0356,-0.298024,-0.05255,0.0356,-0.296461,0.052274,0.037164,-0.298025,0.05255,0.0356,-0.29646,-0.052274,0.037164,-0.294324,0.051897,0.037737,-0.296461,0.052274,0.037164,-0.262582,0.151601,0.033463,-0.298025,0.05255,0.0356,-0.262078,0.151311,0.0356,-0.298025,0.05255,0.0356,-0.260703,0.150517,0.037164,-0.262078,0.151311,0.0356,-0.260703,0.150517,0.037164,-0.294324,0.051897,0.037737,-0.258824,0.149432,0.037737,-0.262582,0.151601,0.033463,-0.194522,0.231821,0.0356,-0.194896,0.232267,0.033463,-0.262078,0.151311,0.0356,-0.193501,0.230605,0.037164,-0.194522,0.231821,0.0356,-0.260703,0.150517,0.037164,-0.192107,0.228943,0.037737,-0.193501,0.230605,0.037164,-0.194896,0.232267,0.033463,-0.103503,0.284371,0.0356,-0.103702,0.284917,0.033463,-0.103503,0.284371,0.0356,-0.193501,0.230605,0.037164,-0.10296,0.282879,0.037164,-0.10296,0.282879,0.037164,-0.192107,0.228943,0.037737,-0.102218,0.28084,0.037737,-0.103702,0.284917,0.033463,-1e-06,0.302621,0.0356,-1e-06,0.303203,0.033463,-1e-06,0.302621,0.0356,-0.10296,0.282879,0.037164,-1e-06,0.301033,0.037164,-1e-06,0.301033,0.037164,-0.102218,0.28084,0.037737,-1e-06,0.298864,0.037737,-1e-06,0.303203,0.033463,0.103502,0.284371,0.0356,0.103701,0.284917,0.033463,0.103502,0.284371,0.0356,-1e-06,0.301033,0.037164,0.102959,0.282879,0.037164,-1e-06,0.301033,0.037164,0.102217,0.28084,0.037737,0.102959,0.282879,0.037164,0.103701,0.284917,0.033463,0.194521,0.231821,0.0356,0.194894,0.232267,0.033463,0.194521,0.231821,0.0356,0.102959,0.282879,0.037164,0.1935,0.230605,0.037164,0.102959,0.282879,0.037164,0.192105,0.228943,0.037737,0.1935,0.230605,0.037164,0.194894,0.232267,0.033463,0.262077,0.15131,0.0356,0.262581,0.151601,0.033463,0.262077,0.15131,0.0356,0.1935,0.230605,0.037164,0.260702,0.150516,0.037164,0.1935,0.230605,0.037164,0.258823,0.149432,0.037737,0.260702,0.150516,0.037164,0.298596,0.05265,0.033463,0.262077,0.15131,0.0356,0.298023,0.052549,0.0356,0.262077,0.15131,0.0356,0.296459,0.052274,0.037164,0.298023,0.052549,0.0356,0.260702,0.150516,0.037164,0.294323,0.051897,0.037737,0.296459,0.052274,0.037164,0.298596,0.05265,0.033463,0.298024,-0.05255,0.0356,0.298596,-0.052651,0.033463,0.298023,0.052549,0.0356,0.296459,-0.052274,0.037164,0.298024,-0.05255,0.0356,0.296459,-0.052274,0.037164,0.294323,0.051897,0.037737,0.294323,-0.051897,0.037737,0.262581,-0.151602,0.033463,0.298024,-0.05255,0.0356,0.262078,-0.151311,0.0356,0.298024,-0.05255,0.0356,0.260702,-0.150517,0.037164,0.262078,-0.151311,0.0356,0.260702,-0.150517,0.037164,0.294323,-0.051897,0.037737,0.258823,-0.149432,0.037737,0.194895,-0.232267,0.033463,0.262078,-0.151311,0.0356,0.194521,-0.231822,0.0356,0.262078,-0.151311,0.0356,0.1935,-0.230605,0.037164,0.194521,-0.231822,0.0356,0.1935,-0.230605,0.037164,0.258823,-0.149432,0.037737,0.192106,-0.228943,0.037737,0.194895,-0.232267,0.033463,0.103502,-0.284372,0.0356,0.103701,-0.284918,0.033463,0.194521,-0.231822,0.0356,0.102959,-0.282879,0.037164,0.103502,-0.284372,0.0356,0.102959,-0.282879,0.037164,0.192106,-0.228943,0.037737,0.102217,-0.280841,0.037737,-0,-0.303203,0.033463,0.103502,-0.284372,0.0356,-0,-0.302622,0.0356,0.103502,-0.284372,0.0356,-0,-0.301034,0.037164,-0,-0.302622,0.0356,0.102959,-0.282879,0.037164,-0,-0.298864,0.037737,-0,-0.301034,0.037164,-0,-0.303203,0.033463,-0.103503,-0.284372,0.0356,-0.103702,-0.284918,0.033463,-0,-0.302622,0.0356,-0.10296,-0.282879,0.037164,-0.103503,-0.284372,0.0356,-0.10296,-0.282879,0.037164,-0,-0.298864,0.037737,-0.102218,-0.280841,0.037737,-0.103702,-0.284918,0.033463,-0.194522,-0.231822,0.0356,-0.194895,-0.232267,0.033463,-0.194522,-0.231822,0.0356,-0.10296,-0.282879,0.037164,-0.193501,-0.230605,0.037164,-0.10296,-0.282879,0.037164,-0.192106,-0.228943,0.037737,-0.193501,-0.230605,0.037164,-0.194895,-0.232267,0.033463,-0.262078,-0.151311,0.0356,-0.262582,-0.151602,0.033463,-0.262078,-0.151311,0.0356,-0.193501,-0.230605,0.037164,-0.260703,-0.150517,0.037164,-0.193501,-0.230605,0.037164,-0.258824,-0.149432,0.037737,-0.260703,-0.150517,0.037164,-0.258824,-0.149432,0.037737,-0.298597,-0.052651,0.006353,-0.261903,-0.15121,0.00347,-0.262582,-0.151602,0.006353,-0.261903,-0.15121,0.00347,-0.295714,-0.052143,0.00136,-0.260047,-0.150138,0.00136,-0.295714,-0.052143,0.00136,-0.257512,-0.148675,0.000587,-0.260047,-0.150138,0.00136,-0.298597,0.05265,0.006353,-0.297825,-0.052515,0.00347,-0.298597,-0.052651,0.006353,-0.297825,-0.052515,0.00347,-0.295714,0.052142,0.00136,-0.295714,-0.052143,0.00136,-0.295714,0.052142,0.00136,-0.292832,-0.051634,0.000587,-0.295714,-0.052143,0.00136,-0.262582,0.151601,0.006353,-0.297825,0.052514,0.00347,-0.298597,0.05265,0.006353,-0.261903,0.151209,0.00347,-0.295714,0.052142,0.00136,-0.297825,0.052514,0.00347,-0.260047,0.150138,0.00136,-0.292832,0.051634,0.000587,-0.295714,0.052142,0.00136,-0.194896,0.232267,0.006353,-0.261903,0.151209,0.00347,-0.262582,0.151601,0.006353,-0.194391,0.231666,0.00347,-0.260047,0.150138,0.00136,-0.261903,0.151209,0.00347,-0.193014,0.230024,0.00136,-0.257512,0.148674,0.000587,-0.260047,0.150138,0.00136,-0.103702,0.284917,0.006353,-0.194391,0.231666,0.00347,-0.194896,0.232267,0.006353,-0.194391,0.231666,0.00347,-0.102701,0.282167,0.00136,-0.193014,0.230024,0.00136,-0.102701,0.282167,0.00136,-0.191132,0.227782,0.000587,-0.193014,0.230024,0.00136,-0.103702,0.284917,0.006353,-1e-06,0.302418,0.00347,-0.103434,0.28418,0.00347,-0.103434,0.28418,0.00347,-1e-06,0.300275,0.00136,-0.102701,0.282167,0.00136,-0.102701,0.282167,0.00136,-1e-06,0.297348,0.000587,-0.1017,0.279416,0.000587,0.103701,0.284917,0.006353,-1e-06,0.302418,0.00347,-1e-06,0.303203,0.006353,-1e-06,0.302418,0.00347,0.1027,0.282167,0.00136,-1e-06,0.300275,0.00136,-1e-06,0.300275,0.00136,0.101699,0.279416,0.000587,-1e-06,0.297348,0.000587,0.103701,0.284917,0.006353,0.19439,0.231666,0.00347,0.103433,0.28418,0.00347,0.19439,0.231666,0.00347,0.1027,0.282167,0.00136,0.103433,0.28418,0.00347,0.1027,0.282167,0.00136,0.191131,0.227782,0.000587,0.101699,0.279416,0.000587,0.194894,0.232267,0.006353,0.261901,0.151209,0.00347,0.19439,0.231666,0.00347,0.261901,0.151209,0.00347,0.193013,0.230024,0.00136,0.19439,0.231666,0.00347,0.193013,0.230024,0.00136,0.257511,0.148674,0.000587,0.191131,0.227782,0.000587,0.298596,0.05265,0.006353,0.261901,0.151209,0.00347,0.262581,0.151601,0.006353,0.297824,0.052514,0.00347,0.260046,0.150138,0.00136,0.261901,0.151209,0.00347,0.260046,0.150138,0.00136,0.29283,0.051634,0.000587,0.257511,0.148674,0.000587,0.298596,0.05265,0.006353,0.297824,-0.052515,0.00347,0.297824,0.052514,0.00347,0.297824,-0.052515,0.00347,0.295713,0.052142,0.00136,0.297824,0.052514,0.00347,0.295713,-0.052143,0.00136,0.29283,0.051634,0.000587,0.295713,0.052142,0.00136,0.298596,-0.052651,0.006353,0.261902,-0.15121,0.00347,0.297824,-0.052515,0.00347,0.261902,-0.15121,0.00347,0.295713,-0.052143,0.00136,0.297824,-0.052515,0.00347,0.260046,-0.150138,0.00136,0.292831,-0.051634,0.000587,0.295713,-0.052143,0.00136,0.194895,-0.232267,0.006353,0.261902,-0.15121,0.00347,0.262581,-0.151602,0.006353,0.261902,-0.15121,0.00347,0.193013,-0.230025,0.00136,0.260046,-0.150138,0.00136,0.260046,-0.150138,0.00136,0.191132,-0.227782,0.000587,0.257511,-0.148675,0.000587,0.103701,-0.284918,0.006353,0.194391,-0.231666,0.00347,0.194895,-0.232267,0.006353,0.194391,-0.231666,0.00347,0.1027,-0.282167,0.00136,0.193013,-0.230025,0.00136,0.1027,-0.282167,0.00136,0.191132,-0.227782,0.000587,0.193013,-0.230025,0.00136,0.103701,-0.284918,0.006353,-0,-0.302419,0.00347,0.103433,-0.284181,0.00347,0.103433,-0.284181,0.00347,-0,-0.300276,0.00136,0.1027,-0.282167,0.00136,0.1027,-0.282167,0.00136,-0,-0.297349,0.000587,0.101699,-0.279417,0.000587,-0.103702,-0.284918,0.006353,-0,-0.302419,0.00347,-0,-0.303203,0.006353,-0.103433,-0.284181,0.00347,-0,-0.300276,0.00136,-0,-0.302419,0.00347,-0.102701,-0.282167,0.00136,-0,-0.297349,0.000587,-0,-0.300276,0.00136,-0.103702,-0.284918,0.006353,-0.194391,-0.231666,0.00347,-0.103433,-0.284181,0.00347,-0.194391,-0.231666,0.00347,-0.102701,-0.282167,0.00136,-0.103433,-0.284181,0.00347,-0.193014,-0.230025,0.00136,-0.101699,-0.279417,0.000587,-0.102701,-0.282167,0.00136,-0.194895,-0.232267,0.006353,-0.261903,-0.15121,0.00347,-0.194391,-0.231666,0.00347,-0.194391,-0.231666,0.00347,-0.260047,-0.150138,0.00136,-0.193014,-0.230025,0.00136,-0.193014,-0.230025,0.00136,-0.257512,-0.148675,0.000587,-0.191132,-0.227783,0.000587,-0.298597,-0.052651,0.030907,-0.298597,-0.052651,0.033463,-0.298597,0.05265,0.033463,0.008596,-0.040283,0.035104,0.007035,-0.048394,0.035104,0.007035,-0.048394,0.035104,-0.010578,-0.050309,0.035104,-0.015993,-0.041197,0.035104,-0.015993,-0.041197,0.035104,-0.001508,-0.052694,0.035104,-0.001508,-0.052694,0.035104,-0.011877,-0.034071,0.035104,-0.011877,-0.034071,0.035104,-0.010578,-0.050309,0.035104,-0.015993,-0.041197,0.035104,-0.001508,-0.052694,0.035104,-0.011877,-0.034071,0.035104,-0.010578,-0.050309,0.035104,0.008596,-0.040283,0.035104,0.007035,-0.048394,0.035104,0.081127,-0.183952,0.030907,0.069424,-0.175488,0.034705,0.069424,-0.175488,0.030907,-0.203765,-0.022783,0.030907,-0.182756,-0.016246,0.034705,-0.182756,-0.016246,0.030907,0.069424,-0.175488,0.030907,0.052627,-0.166932,0.034705,0.052627,-0.166932,0.030907,0.052627,-0.166932,0.030907,0.038638,-0.162241,0.034705,0.038638,-0.162241,0.030907,-0.182756,-0.016246,0.030907,-0.159699,-0.014336,0.034705,-0.159699,-0.014336,0.030907,0.038638,-0.162241,0.030907,0.020945,-0.160363,0.034705,0.020945,-0.160363,0.030907,-0.159699,-0.014336,0.030907,-0.136568,-0.012907,0.034705,-0.136568,-0.012907,0.030907,0.020945,-0.160363,0.030907,0.002331,-0.163955,0.034705,0.002331,-0.163955,0.030907,-0.136568,-0.012907,0.030907,-0.123316,-0.008679,0.034705,-0.123316,-0.008679,0.030907,-0.136028,-0.015788,0.037614,-0.163902,-0.070025,0.037614,-0.148384,-0.082094,0.037614,0.002331,-0.163955,0.030907,-0.014548,-0.169468,0.034705,-0.014548,-0.169468,0.030907,-0.123316,-0.008679,0.030907,-0.102718,0.000283,0.034705,-0.102718,0.000283,0.030907,-0.014548,-0.169468,0.030907,-0.034296,-0.178992,0.034705,-0.034296,-0.178992,0.030907,-0.102718,0.000283,0.030907,-0.077313,0.01509,0.034705,-0.077313,0.01509,0.030907,-0.034296,-0.178992,0.030907,-0.058339,-0.194038,0.034705,-0.058339,-0.194038,0.030907,-0.077313,0.01509,0.030907,-0.062846,0.023603,0.034705,-0.062846,0.023603,0.030907,-0.058339,-0.194038,0.030907,-0.070897,-0.197475,0.034705,-0.070897,-0.197475,0.030907,-0.070897,-0.197475,0.030907,-0.083004,-0.196459,0.034705,-0.083004,-0.196459,0.030907,0.114812,-0.030103,0.030907,0.120469,-0.042197,0.034705,0.120469,-0.042197,0.030907,-0.083004,-0.196459,0.030907,-0.094188,-0.189123,0.034705,-0.094188,-0.189123,0.030907,-0.094188,-0.189123,0.030907,-0.105753,-0.176016,0.034705,-0.105753,-0.176016,0.030907,-0.105753,-0.176016,0.030907,-0.114229,-0.160434,0.034705,-0.114229,-0.160434,0.030907,-0.114229,-0.160434,0.030907,-0.123926,-0.135271,0.034705,-0.123926,-0.135271,0.030907,-0.123926,-0.135271,0.030907,-0.128865,-0.114877,0.034705,-0.128865,-0.114877,0.030907,0.120469,-0.042197,0.030907,0.131031,-0.076484,0.034705,0.131031,-0.076484,0.030907,-0.128865,-0.114877,0.030907,-0.135028,-0.101914,0.034705,-0.135028,-0.101914,0.030907,-0.135028,-0.101914,0.030907,-0.150394,-0.084216,0.034705,-0.150394,-0.084216,0.030907,-0.150394,-0.084216,0.030907,-0.165518,-0.072453,0.034705,-0.165518,-0.072453,0.030907,-0.165518,-0.072453,0.030907,-0.197186,-0.054621,0.034705,-0.197186,-0.054621,0.030907,0.131031,-0.076484,0.030907,0.141306,-0.123951,0.034705,0.141306,-0.123951,0.030907,-0.197186,-0.054621,0.030907,-0.216562,-0.040771,0.034705,-0.216562,-0.040771,0.030907,0.141306,-0.123951,0.030907,0.145823,-0.148526,0.034705,0.145823,-0.148526,0.030907,0.145823,-0.148526,0.030907,0.143055,-0.165651,0.034705,0.143055,-0.165651,0.030907,-0.222513,-0.03513,0.030907,-0.203765,-0.022783,0.034705,-0.203765,-0.022783,0.030907,0.143055,-0.165651,0.030907,0.137296,-0.180078,0.034705,0.137296,-0.180078,0.030907,0.137296,-0.180078,0.030907,0.126149,-0.190577,0.034705,0.126149,-0.190577,0.030907,0.126149,-0.190577,0.030907,0.108872,-0.195216,0.034705,0.108872,-0.195216,0.030907,-0.031748,0.035906,0.037614,-0.012663,-0.031304,0.037614,-0.005756,-0.027991,0.037614,0.108872,-0.195216,0.030907,0.092747,-0.192357,0.034705,0.092747,-0.192357,0.030907,0.092747,-0.192357,0.030907,0.081127,-0.183952,0.034705,0.081127,-0.183952,0.030907,-0.217851,-0.035542,0.037614,-0.203397,-0.023561,0.036762,-0.221148,-0.035251,0.036762,-0.221148,-0.035251,0.036762,-0.203765,-0.022783,0.034705,-0.222513,-0.03513,0.034705,-0.202508,-0.025438,0.037614,-0.182593,-0.017087,0.036762,-0.203397,-0.023561,0.036762,-0.203397,-0.023561,0.036762,-0.182756,-0.016246,0.034705,-0.203765,-0.022783,0.034705,-0.182198,-0.019118,0.037614,-0.159637,-0.015186,0.036762,-0.182593,-0.017087,0.036762,-0.182593,-0.017087,0.036762,-0.159699,-0.014336,0.034705,-0.182756,-0.016246,0.034705,-0.159489,-0.017237,0.037614,-0.13641,-0.013751,0.036762,-0.159637,-0.015186,0.036762,-0.159637,-0.015186,0.036762,-0.136568,-0.012907,0.034705,-0.159699,-0.014336,0.034705,-0.122291,-0.011405,0.037614,-0.13641,-0.013751,0.036762,-0.136028,-0.015788,0.037614,-0.123016,-0.009478,0.036762,-0.136568,-0.012907,0.034705,-0.13641,-0.013751,0.036762,-0.122291,-0.011405,0.037614,-0.102332,-0.000478,0.036762,-0.123016,-0.009478,0.036762,-0.123016,-0.009478,0.036762,-0.102718,0.000283,0.034705,-0.123316,-0.008679,0.034705,-0.075844,0.012579,0.037614,-0.102332,-0.000478,0.036762,-0.101401,-0.002315,0.037614,-0.076883,0.014354,0.036762,-0.102718,0.000283,0.034705,-0.102332,-0.000478,0.036762,0.117749,-0.043246,0.037614,0.113892,-0.030146,0.036762,0.11167,-0.030249,0.037614,0.119672,-0.042504,0.036762,0.114812,-0.030103,0.034705,0.113892,-0.030146,0.036762,0.117749,-0.043246,0.037614,0.130206,-0.0767,0.036762,0.119672,-0.042504,0.036762,0.119672,-0.042504,0.036762,0.131031,-0.076484,0.034705,0.120469,-0.042197,0.034705,0.128214,-0.077221,0.037614,0.140472,-0.124123,0.036762,0.130206,-0.0767,0.036762,0.130206,-0.0767,0.036762,0.141306,-0.123951,0.034705,0.131031,-0.076484,0.034705,0.142871,-0.148558,0.037614,0.140472,-0.124123,0.036762,0.138457,-0.124536,0.037614,0.144958,-0.148536,0.036762,0.141306,-0.123951,0.034705,0.140472,-0.124123,0.036762,0.142871,-0.148558,0.037614,0.142229,-0.165423,0.036762,0.144958,-0.148536,0.036762,0.144958,-0.148536,0.036762,0.143055,-0.165651,0.034705,0.145823,-0.148526,0.034705,0.134833,-0.178402,0.037614,0.142229,-0.165423,0.036762,0.140235,-0.164871,0.037614,0.136575,-0.179587,0.036762,0.143055,-0.165651,0.034705,0.142229,-0.165423,0.036762,0.124688,-0.187958,0.037614,0.136575,-0.179587,0.036762,0.134833,-0.178402,0.037614,0.125721,-0.18981,0.036762,0.137296,-0.180078,0.034705,0.136575,-0.179587,0.036762,0.124688,-0.187958,0.037614,0.108835,-0.194344,0.036762,0.125721,-0.18981,0.036762,0.125721,-0.18981,0.036762,0.108872,-0.195216,0.034705,0.126149,-0.190577,0.034705,0.093911,-0.18961,0.037614,0.108835,-0.194344,0.036762,0.108743,-0.19224,0.037614,0.093088,-0.191553,0.036762,0.108872,-0.195216,0.034705,0.108835,-0.194344,0.036762,0.093911,-0.18961,0.037614,0.080176,-0.182213,0.036762,0.093088,-0.191553,0.036762,0.093088,-0.191553,0.036762,0.081127,-0.183952,0.034705,0.092747,-0.192357,0.034705,0.077882,-0.178016,0.037614,0.06987,-0.174759,0.036762,0.080176,-0.182213,0.036762,0.080176,-0.182213,0.036762,0.069424,-0.175488,0.034705,0.081127,-0.183952,0.034705,0.053756,-0.164243,0.037614,0.06987,-0.174759,0.036762,0.070946,-0.172999,0.037614,0.052958,-0.166144,0.036762,0.069424,-0.175488,0.034705,0.06987,-0.174759,0.036762,0.053756,-0.164243,0.037614,0.038821,-0.161404,0.036762,0.052958,-0.166144,0.036762,0.052958,-0.166144,0.036762,0.038638,-0.162241,0.034705,0.052627,-0.166932,0.034705,0.039262,-0.159382,0.037614,0.020908,-0.159502,0.036762,0.038821,-0.161404,0.036762,0.038821,-0.161404,0.036762,0.020945,-0.160363,0.034705,0.038638,-0.162241,0.034705,0.001601,-0.161134,0.037614,0.020908,-0.159502,0.036762,0.02082,-0.157425,0.037614,0.002117,-0.163129,0.036762,0.020945,-0.160363,0.034705,0.020908,-0.159502,0.036762,0.001601,-0.161134,0.037614,-0.014867,-0.168676,0.036762,0.002117,-0.163129,0.036762,0.002117,-0.163129,0.036762,-0.014548,-0.169468,0.034705,0.002331,-0.163955,0.034705,-0.035703,-0.176442,0.037614,-0.014867,-0.168676,0.036762,-0.015637,-0.166764,0.037614,-0.034708,-0.178245,0.036762,-0.014548,-0.169468,0.034705,-0.014867,-0.168676,0.036762,-0.059519,-0.191346,0.037614,-0.034708,-0.178245,0.036762,-0.035703,-0.176442,0.037614,-0.058685,-0.19325,0.036762,-0.034296,-0.178992,0.034705,-0.034708,-0.178245,0.036762,-0.071167,-0.194534,0.037614,-0.058685,-0.19325,0.036762,-0.059519,-0.191346,0.037614,-0.070976,-0.196613,0.036762,-0.058339,-0.194038,0.034705,-0.058685,-0.19325,0.036762,-0.082026,-0.193622,0.037614,-0.070976,-0.196613,0.036762,-0.071167,-0.194534,0.037614,-0.082718,-0.195628,0.036762,-0.070897,-0.197475,0.034705,-0.070976,-0.196613,0.036762,-0.082026,-0.193622,0.037614,-0.093625,-0.188473,0.036762,-0.082718,-0.195628,0.036762,-0.082718,-0.195628,0.036762,-0.094188,-0.189123,0.034705,-0.083004,-0.196459,0.034705,-0.092265,-0.186905,0.037614,-0.105051,-0.175524,0.036762,-0.093625,-0.188473,0.036762,-0.093625,-0.188473,0.036762,-0.105753,-0.176016,0.034705,-0.094188,-0.189123,0.034705,-0.103355,-0.174338,0.037614,-0.113454,-0.160076,0.036762,-0.105051,-0.175524,0.036762,-0.105051,-0.175524,0.036762,-0.114229,-0.160434,0.034705,-0.105753,-0.176016,0.034705,-0.111583,-0.159211,0.037614,-0.123111,-0.135016,0.036762,-0.113454,-0.160076,0.036762,-0.113454,-0.160076,0.036762,-0.123926,-0.135271,0.034705,-0.114229,-0.160434,0.034705,-0.121144,-0.134402,0.037614,-0.128058,-0.114591,0.036762,-0.123111,-0.135016,0.036762,-0.123111,-0.135016,0.036762,-0.128865,-0.114877,0.034705,-0.123926,-0.135271,0.034705,-0.12611,-0.1139,0.037614,-0.134309,-0.101444,0.036762,-0.128058,-0.114591,0.036762,-0.128058,-0.114591,0.036762,-0.135028,-0.101914,0.034705,-0.128865,-0.114877,0.034705,-0.148384,-0.082094,0.037614,-0.134309,-0.101444,0.036762,-0.132572,-0.100307,0.037614,-0.149805,-0.083594,0.036762,-0.135028,-0.101914,0.034705,-0.134309,-0.101444,0.036762,-0.163902,-0.070025,0.037614,-0.149805,-0.083594,0.036762,-0.148384,-0.082094,0.037614,-0.165044,-0.071742,0.036762,-0.150394,-0.084216,0.034705,-0.149805,-0.083594,0.036762,-0.195622,-0.052164,0.037614,-0.165044,-0.071742,0.036762,-0.163902,-0.070025,0.037614,-0.196728,-0.053901,0.036762,-0.165518,-0.072453,0.034705,-0.165044,-0.071742,0.036762,-0.214708,-0.038522,0.037614,-0.196728,-0.053901,0.036762,-0.195622,-0.052164,0.037614,-0.216019,-0.040112,0.036762,-0.197186,-0.054621,0.034705,-0.196728,-0.053901,0.036762,-0.217851,-0.035542,0.037614,-0.216019,-0.040112,0.036762,-0.214708,-0.038522,0.037614,-0.221148,-0.035251,0.036762,-0.216562,-0.040771,0.034705,-0.216019,-0.040112,0.036762,-0.075844,0.012579,0.037614,-0.06213,0.023036,0.036762,-0.076883,0.014354,0.036762,-0.076883,0.014354,0.036762,-0.062846,0.023603,0.034705,-0.077313,0.01509,0.034705,-0.216562,-0.040771,0.030907,-0.222513,-0.03513,0.034705,-0.222513,-0.03513,0.030907,-0.004946,-0.030733,0.035104,-0.012663,-0.031304,0.037614,-0.011877,-0.034071,0.035104,-0.004946,-0.030733,0.035104,0.006303,-0.030589,0.037614,-0.005756,-0.027991,0.037614,0.004631,-0.032796,0.035104,0.010762,-0.039011,0.037614,0.006303,-0.030589,0.037614,0.007035,-0.048394,0.035104,0.010762,-0.039011,0.037614,0.008596,-0.040283,0.035104,-0.001507,-0.052694,0.035104,0.008437,-0.05096,0.037614,0.007035,-0.048394,0.035104,-0.001507,-0.052694,0.035104,-0.012211,-0.052475,0.037614,-0.000648,-0.055515,0.037614,-0.010578,-0.050309,0.035104,-0.018651,-0.041637,0.037614,-0.012211,-0.052475,0.037614,-0.011877,-0.034071,0.035104,-0.018651,-0.041637,0.037614,-0.015993,-0.041197,0.035104,-0.010578,-0.050309,0.035104,-0.00207,-0.049644,0.039021,-0.008743,-0.04789,0.039021,0.008596,-0.040283,0.035104,0.004214,-0.046481,0.039021,0.007035,-0.048394,0.035104,-0.004946,-0.030733,0.035104,0.002446,-0.035007,0.039021,0.004631,-0.032796,0.035104,-0.010578,-0.050309,0.035104,-0.012726,-0.041187,0.039021,-0.015993,-0.041197,0.035104,-0.001507,-0.052694,0.035104,0.004214,-0.046481,0.039021,-0.00207,-0.049644,0.039021,0.004631,-0.032796,0.035104,0.005362,-0.040515,0.039021,0.008596,-0.040283,0.035104,-0.004946,-0.030733,0.035104,-0.009698,-0.035945,0.039021,-0.011877,-0.034071,0.035104,-0.011877,-0.034071,0.035104,-0.012726,-0.041187,0.039021,-0.009698,-0.035945,0.039021,-0.009698,-0.035945,0.039021,-0.004599,-0.033489,0.039021,-0.006475,-0.040778,0.041809,-0.009698,-0.035945,0.039021,-0.012726,-0.041187,0.039021,-0.006475,-0.040778,0.041809,-0.008743,-0.04789,0.039021,-0.00207,-0.049644,0.039021,-0.006475,-0.040778,0.041809,0.004214,-0.046481,0.039021,0.005362,-0.040515,0.039021,-0.006475,-0.040778,0.041809,0.002446,-0.035007,0.039021,-0.004599,-0.033489,0.039021,-0.006475,-0.040778,0.041809,-0.012726,-0.041187,0.039021,-0.008743,-0.04789,0.039021,-0.006475,-0.040778,0.041809,-0.00207,-0.049644,0.039021,0.004214,-0.046481,0.039021,-0.006475,-0.040778,0.041809,0.005362,-0.040515,0.039021,0.002446,-0.035007,0.039021,-0.006475,-0.040778,0.041809,0.179657,0.150663,0.030907,0.114812,-0.030103,0.034705,0.114812,-0.030103,0.030907,-0.062846,0.023603,0.030907,-0.000999,0.222053,0.034705,-0.000999,0.222053,0.030907,0.015066,0.088977,0.037614,0.016831,0.034532,0.037614,0.040394,0.029986,0.037614,0.01689,0.096776,0.030907,0.093858,0.20895,0.034705,0.093858,0.20895,0.030907,0.093858,0.20895,0.030907,0.095476,0.06791,0.034705,0.095476,0.06791,0.030907,0.095476,0.06791,0.030907,0.179657,0.150663,0.034705,0.179657,0.150663,0.030907,-0.000999,0.222053,0.030907,0.01689,0.096776,0.034705,0.01689,0.096776,0.030907,-0.002057,0.208884,0.037614,-0.06213,0.023036,0.036762,-0.060403,0.021666,0.037614,-0.001309,0.218196,0.036762,-0.062846,0.023603,0.034705,-0.06213,0.023036,0.036762,-0.002057,0.208884,0.037614,0.016356,0.094492,0.036762,-0.001309,0.218196,0.036762,-0.001309,0.218196,0.036762,0.01689,0.096776,0.034705,-0.000999,0.222053,0.034705,0.091055,0.199724,0.037614,0.016356,0.094492,0.036762,0.015066,0.088977,0.037614,0.093037,0.206248,0.036762,0.01689,0.096776,0.034705,0.016356,0.094492,0.036762,0.091055,0.199724,0.037614,0.094647,0.065901,0.036762,0.093037,0.206248,0.036762,0.093037,0.206248,0.036762,0.095476,0.06791,0.034705,0.093858,0.20895,0.034705,0.172624,0.139671,0.037614,0.094647,0.065901,0.036762,0.092646,0.06105,0.037614,0.177597,0.147444,0.036762,0.095476,0.06791,0.034705,0.094647,0.065901,0.036762,0.172624,0.139671,0.037614,0.113892,-0.030146,0.036762,0.177597,0.147444,0.036762,0.177597,0.147444,0.036762,0.114812,-0.030103,0.034705,0.179657,0.150663,0.034705,-0.004946,-0.030733,0.035104,-0.011877,-0.034071,0.035104,-0.011877,-0.034071,0.035104,0.004631,-0.032796,0.035104,0.004631,-0.032796,0.035104,0.008596,-0.040283,0.035104,0.008596,-0.040283,0.035104,0.008596,-0.040283,0.035104,-0.004946,-0.030733,0.035104,-0.011877,-0.034071,0.035104,0.004631,-0.032796,0.035104,-0.262582,0.151601,0.030907,-0.262582,0.151601,0.006353,-0.298597,0.05265,0.006353,-0.194896,0.232267,0.030907,-0.194896,0.232267,0.030907,-0.194896,0.232267,0.006353,-0.262582,0.151601,0.030907,-0.262582,0.151601,0.006353,-0.103702,0.284917,0.030907,-0.103702,0.284917,0.006353,-0.194896,0.232267,0.006353,-1e-06,0.303203,0.030907,-1e-06,0.303203,0.006353,-0.103702,0.284917,0.006353,0.103701,0.284917,0.030907,0.103701,0.284917,0.006353,-1e-06,0.303203,0.006353,0.194894,0.232267,0.030907,0.194894,0.232267,0.006353,0.103701,0.284917,0.006353,0.262581,0.151601,0.030907,0.262581,0.151601,0.006353,0.194894,0.232267,0.006353,0.298596,0.05265,0.030907,0.298596,0.05265,0.006353,0.262581,0.151601,0.006353,0.298596,-0.052651,0.030907,0.298596,-0.052651,0.006353,0.298596,0.05265,0.006353,0.262581,-0.151602,0.030907,0.262581,-0.151602,0.006353,0.298596,-0.052651,0.006353,0.194895,-0.232267,0.030907,0.194895,-0.232267,0.006353,0.262581,-0.151602,0.006353,0.103701,-0.284918,0.030907,0.103701,-0.284918,0.006353,0.194895,-0.232267,0.006353,-0,-0.303203,0.030907,-0,-0.303203,0.006353,0.103701,-0.284918,0.006353,-0.103702,-0.284918,0.030907,-0.103702,-0.284918,0.006353,-0,-0.303203,0.006353,-0.298597,-0.052651,0.030907,-0.298597,-0.052651,0.006353,-0.262582,-0.151602,0.006353,-0.194895,-0.232267,0.030907,-0.194895,-0.232267,0.006353,-0.103702,-0.284918,0.006353,-0.185844,0.221479,0.035466,-0.250386,-0.144561,0.035466,-0.284729,0.050205,0.035466,-0.250387,0.14456,0.035466,-0.098886,0.271685,0.035466,-1e-06,0.289121,0.035466,0.098885,0.271685,0.035466,0.185843,0.221479,0.035466,0.250385,0.14456,0.035466,0.284728,0.050205,0.035466,0.284728,-0.050206,0.035466,0.250386,-0.144561,0.035466,0.185843,-0.22148,0.035466,0.098885,-0.271685,0.035466,-0,-0.289121,0.035466,-0.098885,-0.271685,0.035466,-0.262582,-0.151602,0.030907,-0.262582,-0.151602,0.006353,-0.194895,-0.232267,0.006353,-0.185844,-0.22148,0.035466,-0.252383,-0.145714,0.037737,-0.250386,-0.144561,0.035466,-0.284729,-0.050206,0.035466,-0.284729,-0.050206,0.035466,-0.287,0.050606,0.037737,-0.284729,0.050205,0.035466,-0.250387,0.14456,0.035466,-0.187326,0.223246,0.037737,-0.252383,0.145713,0.037737,-0.250387,0.14456,0.035466,-0.187326,0.223246,0.037737,-0.185844,0.221479,0.035466,-0.098886,0.271685,0.035466,-0.099674,0.273851,0.037737,-0.098886,0.271685,0.035466,-1e-06,0.289121,0.035466,0.099673,0.273851,0.037737,-1e-06,0.291426,0.037737,-1e-06,0.289121,0.035466,0.187325,0.223246,0.037737,0.099673,0.273851,0.037737,0.098885,0.271685,0.035466,0.252382,0.145713,0.037737,0.187325,0.223246,0.037737,0.185843,0.221479,0.035466,0.252382,0.145713,0.037737,0.250385,0.14456,0.035466,0.284728,0.050205,0.035466,0.284728,0.050205,0.035466,0.252382,-0.145714,0.037737,0.286999,-0.050606,0.037737,0.284728,-0.050206,0.035466,0.187325,-0.223246,0.037737,0.252382,-0.145714,0.037737,0.250386,-0.144561,0.035466,0.185843,-0.22148,0.035466,0.098885,-0.271685,0.035466,-0,-0.291427,0.037737,-0,-0.289121,0.035466,-0.098885,-0.271685,0.035466,-0.187326,-0.223246,0.037737,-0.099674,-0.273852,0.037737,-0.098885,-0.271685,0.035466,-0.252383,-0.145714,0.037737,-0.187326,-0.223246,0.037737,-0.185844,-0.22148,0.035466,-0.284729,-0.050206,0.035466,-0.298597,-0.052651,0.033463,-0.262582,-0.151602,0.033463,-0.262078,-0.151311,0.0356,-0.260703,-0.150517,0.037164,-0.258824,-0.149432,0.037737,-0.298597,0.05265,0.033463,-0.298597,-0.052651,0.033463,-0.298024,-0.05255,0.0356,-0.298024,-0.05255,0.0356,-0.29646,-0.052274,0.037164,-0.296461,0.052274,0.037164,-0.29646,-0.052274,0.037164,-0.294324,-0.051897,0.037737,-0.294324,0.051897,0.037737,-0.262582,0.151601,0.033463,-0.298597,0.05265,0.033463,-0.298025,0.05255,0.0356,-0.298025,0.05255,0.0356,-0.296461,0.052274,0.037164,-0.260703,0.150517,0.037164,-0.260703,0.150517,0.037164,-0.296461,0.052274,0.037164,-0.294324,0.051897,0.037737,-0.262582,0.151601,0.033463,-0.262078,0.151311,0.0356,-0.194522,0.231821,0.0356,-0.262078,0.151311,0.0356,-0.260703,0.150517,0.037164,-0.193501,0.230605,0.037164,-0.260703,0.150517,0.037164,-0.258824,0.149432,0.037737,-0.192107,0.228943,0.037737,-0.194896,0.232267,0.033463,-0.194522,0.231821,0.0356,-0.103503,0.284371,0.0356,-0.103503,0.284371,0.0356,-0.194522,0.231821,0.0356,-0.193501,0.230605,0.037164,-0.10296,0.282879,0.037164,-0.193501,0.230605,0.037164,-0.192107,0.228943,0.037737,-0.103702,0.284917,0.033463,-0.103503,0.284371,0.0356,-1e-06,0.302621,0.0356,-1e-06,0.302621,0.0356,-0.103503,0.284371,0.0356,-0.10296,0.282879,0.037164,-0.10296,0.282879,0.037164,-1e-06,0.303203,0.033463,-1e-06,0.302621,0.0356,0.103502,0.284371,0.0356,0.103502,0.284371,0.0356,-1e-06,0.302621,0.0356,-1e-06,0.301033,0.037164,-1e-06,0.301033,0.037164,-1e-06,0.298864,0.037737,0.102217,0.28084,0.037737,0.103701,0.284917,0.033463,0.103502,0.284371,0.0356,0.194521,0.231821,0.0356,0.194521,0.231821,0.0356,0.103502,0.284371,0.0356,0.102959,0.282879,0.037164,0.102959,0.282879,0.037164,0.102217,0.28084,0.037737,0.192105,0.228943,0.037737,0.194894,0.232267,0.033463,0.194521,0.231821,0.0356,0.262077,0.15131,0.0356,0.262077,0.15131,0.0356,0.194521,0.231821,0.0356,0.1935,0.230605,0.037164,0.1935,0.230605,0.037164,0.192105,0.228943,0.037737,0.258823,0.149432,0.037737,0.298596,0.05265,0.033463,0.262581,0.151601,0.033463,0.262077,0.15131,0.0356,0.262077,0.15131,0.0356,0.260702,0.150516,0.037164,0.296459,0.052274,0.037164,0.260702,0.150516,0.037164,0.258823,0.149432,0.037737,0.294323,0.051897,0.037737,0.298596,0.05265,0.033463,0.298023,0.052549,0.0356,0.298024,-0.05255,0.0356,0.298023,0.052549,0.0356,0.296459,0.052274,0.037164,0.296459,-0.052274,0.037164,0.296459,0.052274,0.037164,0.262581,-0.151602,0.033463,0.298596,-0.052651,0.033463,0.298024,-0.05255,0.0356,0.298024,-0.05255,0.0356,0.296459,-0.052274,0.037164,0.260702,-0.150517,0.037164,0.260702,-0.150517,0.037164,0.296459,-0.052274,0.037164,0.294323,-0.051897,0.037737,0.194895,-0.232267,0.033463,0.262581,-0.151602,0.033463,0.262078,-0.151311,0.0356,0.262078,-0.151311,0.0356,0.260702,-0.150517,0.037164,0.1935,-0.230605,0.037164,0.1935,-0.230605,0.037164,0.260702,-0.150517,0.037164,0.258823,-0.149432,0.037737,0.194895,-0.232267,0.033463,0.194521,-0.231822,0.0356,0.103502,-0.284372,0.0356,0.194521,-0.231822,0.0356,0.1935,-0.230605,0.037164,0.102959,-0.282879,0.037164,0.102959,-0.282879,0.037164,0.1935,-0.230605,0.037164,0.192106,-0.228943,0.037737,-0,-0.303203,0.033463,0.103701,-0.284918,0.033463,0.103502,-0.284372,0.0356,0.103502,-0.284372,0.0356,0.102959,-0.282879,0.037164,-0,-0.301034,0.037164,0.102217,-0.280841,0.037737,-0,-0.303203,0.033463,-0,-0.302622,0.0356,-0.103503,-0.284372,0.0356,-0,-0.302622,0.0356,-0,-0.301034,0.037164,-0.10296,-0.282879,0.037164,-0,-0.301034,0.037164,-0.103702,-0.284918,0.033463,-0.103503,-0.284372,0.0356,-0.194522,-0.231822,0.0356,-0.194522,-0.231822,0.0356,-0.103503,-0.284372,0.0356,-0.10296,-0.282879,0.037164,-0.102218,-0.280841,0.037737,-0.194522,-0.231822,0.0356,-0.262078,-0.151311,0.0356,-0.194522,-0.231822,0.0356,-0.193501,-0.230605,0.037164,-0.193501,-0.230605,0.037164,-0.192106,-0.228943,0.037737,-0.258824,-0.149432,0.037737,-0.298597,-0.052651,0.006353,-0.297825,-0.052515,0.00347,-0.261903,-0.15121,0.00347,-0.261903,-0.15121,0.00347,-0.297825,-0.052515,0.00347,-0.295714,-0.052143,0.00136,-0.295714,-0.052143,0.00136,-0.292832,-0.051634,0.000587,-0.257512,-0.148675,0.000587,-0.298597,0.05265,0.006353,-0.297825,0.052514,0.00347,-0.297825,-0.052515,0.00347,-0.297825,0.052514,0.00347,-0.292832,0.051634,0.000587,-0.262582,0.151601,0.006353,-0.261903,0.151209,0.00347,-0.297825,0.052514,0.00347,-0.261903,0.151209,0.00347,-0.260047,0.150138,0.00136,-0.295714,0.052142,0.00136,-0.260047,0.150138,0.00136,-0.257512,0.148674,0.000587,-0.292832,0.051634,0.000587,-0.194896,0.232267,0.006353,-0.194391,0.231666,0.00347,-0.261903,0.151209,0.00347,-0.194391,0.231666,0.00347,-0.193014,0.230024,0.00136,-0.260047,0.150138,0.00136,-0.193014,0.230024,0.00136,-0.191132,0.227782,0.000587,-0.257512,0.148674,0.000587,-0.103702,0.284917,0.006353,-0.103434,0.28418,0.00347,-0.194391,0.231666,0.00347,-0.194391,0.231666,0.00347,-0.103434,0.28418,0.00347,-0.102701,0.282167,0.00136,-0.102701,0.282167,0.00136,-0.1017,0.279416,0.000587,-0.191132,0.227782,0.000587,-0.103702,0.284917,0.006353,-1e-06,0.303203,0.006353,-1e-06,0.302418,0.00347,-0.103434,0.28418,0.00347,-1e-06,0.302418,0.00347,-1e-06,0.300275,0.00136,-0.102701,0.282167,0.00136,-1e-06,0.300275,0.00136,-1e-06,0.297348,0.000587,0.103701,0.284917,0.006353,0.103433,0.28418,0.00347,-1e-06,0.302418,0.00347,-1e-06,0.302418,0.00347,0.103433,0.28418,0.00347,0.1027,0.282167,0.00136,-1e-06,0.300275,0.00136,0.1027,0.282167,0.00136,0.101699,0.279416,0.000587,0.103701,0.284917,0.006353,0.194894,0.232267,0.006353,0.19439,0.231666,0.00347,0.19439,0.231666,0.00347,0.193013,0.230024,0.00136,0.1027,0.282167,0.00136,0.1027,0.282167,0.00136,0.193013,0.230024,0.00136,0.191131,0.227782,0.000587,0.194894,0.232267,0.006353,0.262581,0.151601,0.006353,0.261901,0.151209,0.00347,0.261901,0.151209,0.00347,0.260046,0.150138,0.00136,0.193013,0.230024,0.00136,0.193013,0.230024,0.00136,0.260046,0.150138,0.00136,0.257511,0.148674,0.000587,0.298596,0.05265,0.006353,0.297824,0.052514,0.00347,0.261901,0.151209,0.00347,0.297824,0.052514,0.00347,0.295713,0.052142,0.00136,0.260046,0.150138,0.00136,0.295713,0.052142,0.00136,0.298596,-0.052651,0.006353,0.295713,-0.052143,0.00136,0.295713,-0.052143,0.00136,0.292831,-0.051634,0.000587,0.29283,0.051634,0.000587,0.298596,-0.052651,0.006353,0.262581,-0.151602,0.006353,0.261902,-0.15121,0.00347,0.261902,-0.15121,0.00347,0.260046,-0.150138,0.00136,0.295713,-0.052143,0.00136,0.260046,-0.150138,0.00136,0.257511,-0.148675,0.000587,0.292831,-0.051634,0.000587,0.194895,-0.232267,0.006353,0.194391,-0.231666,0.00347,0.261902,-0.15121,0.00347,0.261902,-0.15121,0.00347,0.194391,-0.231666,0.00347,0.193013,-0.230025,0.00136,0.260046,-0.150138,0.00136,0.193013,-0.230025,0.00136,0.191132,-0.227782,0.000587,0.103701,-0.284918,0.006353,0.103433,-0.284181,0.00347,0.194391,-0.231666,0.00347,0.194391,-0.231666,0.00347,0.103433,-0.284181,0.00347,0.1027,-0.282167,0.00136,0.1027,-0.282167,0.00136,0.101699,-0.279417,0.000587,0.191132,-0.227782,0.000587,0.103701,-0.284918,0.006353,-0,-0.303203,0.006353,-0,-0.302419,0.00347,0.103433,-0.284181,0.00347,-0,-0.302419,0.00347,-0,-0.300276,0.00136,0.1027,-0.282167,0.00136,-0,-0.300276,0.00136,-0,-0.297349,0.000587,-0.103702,-0.284918,0.006353,-0.103433,-0.284181,0.00347,-0,-0.302419,0.00347,-0.103433,-0.284181,0.00347,-0.102701,-0.282167,0.00136,-0,-0.300276,0.00136,-0.102701,-0.282167,0.00136,-0.101699,-0.279417,0.000587,-0,-0.297349,0.000587,-0.103702,-0.284918,0.006353,-0.194895,-0.232267,0.006353,-0.194391,-0.231666,0.00347,-0.194391,-0.231666,0.00347,-0.193014,-0.230025,0.00136,-0.102701,-0.282167,0.00136,-0.193014,-0.230025,0.00136,-0.191132,-0.227783,0.000587,-0.101699,-0.279417,0.000587,-0.194895,-0.232267,0.006353,-0.262582,-0.151602,0.006353,-0.261903,-0.15121,0.00347,-0.194391,-0.231666,0.00347,-0.261903,-0.15121,0.00347,-0.260047,-0.150138,0.00136,-0.193014,-0.230025,0.00136,-0.260047,-0.150138,0.00136,-0.257512,-0.148675,0.000587,-0.298597,0.05265,0.030907,-0.298597,0.05265,0.006353,-0.298597,-0.052651,0.006353,0.008596,-0.040283,0.035104,0.081127,-0.183952,0.034705,-0.203765,-0.022783,0.034705,0.069424,-0.175488,0.034705,0.052627,-0.166932,0.034705,-0.182756,-0.016246,0.034705,0.038638,-0.162241,0.034705,-0.159699,-0.014336,0.034705,0.020945,-0.160363,0.034705,-0.136568,-0.012907,0.034705,0.070946,-0.172999,0.037614,0.077882,-0.178016,0.037614,0.008437,-0.05096,0.037614,0.053756,-0.164243,0.037614,-0.000648,-0.055515,0.037614,0.02082,-0.157425,0.037614,0.039262,-0.159382,0.037614,-0.012211,-0.052475,0.037614,0.001601,-0.161134,0.037614,-0.018651,-0.041637,0.037614,-0.075844,0.012579,0.037614,-0.060403,0.021666,0.037614,-0.05088,0.030645,0.037614,-0.12611,-0.1139,0.037614,-0.015637,-0.166764,0.037614,-0.121144,-0.134402,0.037614,-0.035703,-0.176442,0.037614,-0.101401,-0.002315,0.037614,-0.071167,-0.194534,0.037614,-0.059519,-0.191346,0.037614,-0.092265,-0.186905,0.037614,-0.103355,-0.174338,0.037614,-0.082026,-0.193622,0.037614,-0.111583,-0.159211,0.037614,-0.132572,-0.100307,0.037614,-0.122291,-0.011405,0.037614,-0.159489,-0.017237,0.037614,-0.182198,-0.019118,0.037614,-0.202508,-0.025438,0.037614,-0.195622,-0.052164,0.037614,-0.217851,-0.035542,0.037614,-0.214708,-0.038522,0.037614,0.002331,-0.163955,0.034705,-0.123316,-0.008679,0.034705,-0.014548,-0.169468,0.034705,-0.102718,0.000283,0.034705,-0.034296,-0.178992,0.034705,-0.077313,0.01509,0.034705,-0.058339,-0.194038,0.034705,-0.070897,-0.197475,0.034705,0.114812,-0.030103,0.034705,-0.083004,-0.196459,0.034705,-0.094188,-0.189123,0.034705,-0.105753,-0.176016,0.034705,-0.114229,-0.160434,0.034705,-0.123926,-0.135271,0.034705,0.120469,-0.042197,0.034705,-0.128865,-0.114877,0.034705,-0.135028,-0.101914,0.034705,-0.150394,-0.084216,0.034705,-0.165518,-0.072453,0.034705,0.131031,-0.076484,0.034705,-0.197186,-0.054621,0.034705,0.141306,-0.123951,0.034705,0.145823,-0.148526,0.034705,-0.222513,-0.03513,0.034705,0.143055,-0.165651,0.034705,0.137296,-0.180078,0.034705,0.126149,-0.190577,0.034705,0.124688,-0.187958,0.037614,0.134833,-0.178402,0.037614,0.108743,-0.19224,0.037614,0.140235,-0.164871,0.037614,0.142871,-0.148558,0.037614,0.138457,-0.124536,0.037614,0.128214,-0.077221,0.037614,0.117749,-0.043246,0.037614,0.11167,-0.030249,0.037614,0.010762,-0.039011,0.037614,0.109909,-0.019619,0.037614,0.098426,-0.005106,0.037614,0.093911,-0.18961,0.037614,0.082264,0.011251,0.037614,0.061977,0.021668,0.037614,0.006303,-0.030589,0.037614,0.040394,0.029986,0.037614,0.016831,0.034532,0.037614,-0.012785,0.036583,0.037614,0.108872,-0.195216,0.034705,0.092747,-0.192357,0.034705,-0.202508,-0.025438,0.037614,-0.221148,-0.035251,0.036762,-0.203397,-0.023561,0.036762,-0.203765,-0.022783,0.034705,-0.202508,-0.025438,0.037614,-0.182198,-0.019118,0.037614,-0.182593,-0.017087,0.036762,-0.203397,-0.023561,0.036762,-0.182593,-0.017087,0.036762,-0.182756,-0.016246,0.034705,-0.182198,-0.019118,0.037614,-0.159489,-0.017237,0.037614,-0.159637,-0.015186,0.036762,-0.182593,-0.017087,0.036762,-0.159637,-0.015186,0.036762,-0.159699,-0.014336,0.034705,-0.159489,-0.017237,0.037614,-0.136028,-0.015788,0.037614,-0.13641,-0.013751,0.036762,-0.159637,-0.015186,0.036762,-0.13641,-0.013751,0.036762,-0.136568,-0.012907,0.034705,-0.122291,-0.011405,0.037614,-0.123016,-0.009478,0.036762,-0.13641,-0.013751,0.036762,-0.123016,-0.009478,0.036762,-0.123316,-0.008679,0.034705,-0.136568,-0.012907,0.034705,-0.122291,-0.011405,0.037614,-0.101401,-0.002315,0.037614,-0.102332,-0.000478,0.036762,-0.123016,-0.009478,0.036762,-0.102332,-0.000478,0.036762,-0.102718,0.000283,0.034705,-0.075844,0.012579,0.037614,-0.076883,0.014354,0.036762,-0.102332,-0.000478,0.036762,-0.076883,0.014354,0.036762,-0.077313,0.01509,0.034705,-0.102718,0.000283,0.034705,0.117749,-0.043246,0.037614,0.119672,-0.042504,0.036762,0.113892,-0.030146,0.036762,0.119672,-0.042504,0.036762,0.120469,-0.042197,0.034705,0.114812,-0.030103,0.034705,0.117749,-0.043246,0.037614,0.128214,-0.077221,0.037614,0.130206,-0.0767,0.036762,0.119672,-0.042504,0.036762,0.130206,-0.0767,0.036762,0.131031,-0.076484,0.034705,0.128214,-0.077221,0.037614,0.138457,-0.124536,0.037614,0.140472,-0.124123,0.036762,0.130206,-0.0767,0.036762,0.140472,-0.124123,0.036762,0.141306,-0.123951,0.034705,0.142871,-0.148558,0.037614,0.144958,-0.148536,0.036762,0.140472,-0.124123,0.036762,0.144958,-0.148536,0.036762,0.145823,-0.148526,0.034705,0.141306,-0.123951,0.034705,0.142871,-0.148558,0.037614,0.140235,-0.164871,0.037614,0.142229,-0.165423,0.036762,0.144958,-0.148536,0.036762,0.142229,-0.165423,0.036762,0.143055,-0.165651,0.034705,0.136575,-0.179587,0.036762,0.136575,-0.179587,0.036762,0.137296,-0.180078,0.034705,0.143055,-0.165651,0.034705,0.124688,-0.187958,0.037614,0.125721,-0.18981,0.036762,0.136575,-0.179587,0.036762,0.125721,-0.18981,0.036762,0.126149,-0.190577,0.034705,0.137296,-0.180078,0.034705,0.108743,-0.19224,0.037614,0.125721,-0.18981,0.036762,0.108835,-0.194344,0.036762,0.108872,-0.195216,0.034705,0.093911,-0.18961,0.037614,0.093088,-0.191553,0.036762,0.108835,-0.194344,0.036762,0.093088,-0.191553,0.036762,0.092747,-0.192357,0.034705,0.108872,-0.195216,0.034705,0.077882,-0.178016,0.037614,0.093088,-0.191553,0.036762,0.077882,-0.178016,0.037614,0.070946,-0.172999,0.037614,0.06987,-0.174759,0.036762,0.080176,-0.182213,0.036762,0.06987,-0.174759,0.036762,0.069424,-0.175488,0.034705,0.053756,-0.164243,0.037614,0.052958,-0.166144,0.036762,0.06987,-0.174759,0.036762,0.052958,-0.166144,0.036762,0.052627,-0.166932,0.034705,0.069424,-0.175488,0.034705,0.039262,-0.159382,0.037614,0.052958,-0.166144,0.036762,0.038821,-0.161404,0.036762,0.038638,-0.162241,0.034705,0.039262,-0.159382,0.037614,0.02082,-0.157425,0.037614,0.020908,-0.159502,0.036762,0.038821,-0.161404,0.036762,0.020908,-0.159502,0.036762,0.020945,-0.160363,0.034705,0.001601,-0.161134,0.037614,0.002117,-0.163129,0.036762,0.020908,-0.159502,0.036762,0.002117,-0.163129,0.036762,0.002331,-0.163955,0.034705,0.020945,-0.160363,0.034705,0.001601,-0.161134,0.037614,-0.015637,-0.166764,0.037614,-0.014867,-0.168676,0.036762,0.002117,-0.163129,0.036762,-0.014867,-0.168676,0.036762,-0.014548,-0.169468,0.034705,-0.035703,-0.176442,0.037614,-0.034708,-0.178245,0.036762,-0.014867,-0.168676,0.036762,-0.034708,-0.178245,0.036762,-0.034296,-0.178992,0.034705,-0.014548,-0.169468,0.034705,-0.059519,-0.191346,0.037614,-0.058685,-0.19325,0.036762,-0.034708,-0.178245,0.036762,-0.058685,-0.19325,0.036762,-0.058339,-0.194038,0.034705,-0.034296,-0.178992,0.034705,-0.071167,-0.194534,0.037614,-0.070976,-0.196613,0.036762,-0.058685,-0.19325,0.036762,-0.070897,-0.197475,0.034705,-0.082026,-0.193622,0.037614,-0.082718,-0.195628,0.036762,-0.070976,-0.196613,0.036762,-0.082718,-0.195628,0.036762,-0.083004,-0.196459,0.034705,-0.070897,-0.197475,0.034705,-0.082026,-0.193622,0.037614,-0.092265,-0.186905,0.037614,-0.093625,-0.188473,0.036762,-0.093625,-0.188473,0.036762,-0.092265,-0.186905,0.037614,-0.103355,-0.174338,0.037614,-0.105051,-0.175524,0.036762,-0.093625,-0.188473,0.036762,-0.105051,-0.175524,0.036762,-0.105753,-0.176016,0.034705,-0.103355,-0.174338,0.037614,-0.111583,-0.159211,0.037614,-0.113454,-0.160076,0.036762,-0.105051,-0.175524,0.036762,-0.113454,-0.160076,0.036762,-0.114229,-0.160434,0.034705,-0.111583,-0.159211,0.037614,-0.121144,-0.134402,0.037614,-0.123111,-0.135016,0.036762,-0.113454,-0.160076,0.036762,-0.123111,-0.135016,0.036762,-0.123926,-0.135271,0.034705,-0.121144,-0.134402,0.037614,-0.12611,-0.1139,0.037614,-0.128058,-0.114591,0.036762,-0.123111,-0.135016,0.036762,-0.128058,-0.114591,0.036762,-0.128865,-0.114877,0.034705,-0.12611,-0.1139,0.037614,-0.132572,-0.100307,0.037614,-0.134309,-0.101444,0.036762,-0.134309,-0.101444,0.036762,-0.148384,-0.082094,0.037614,-0.149805,-0.083594,0.036762,-0.134309,-0.101444,0.036762,-0.149805,-0.083594,0.036762,-0.150394,-0.084216,0.034705,-0.135028,-0.101914,0.034705,-0.163902,-0.070025,0.037614,-0.165044,-0.071742,0.036762,-0.149805,-0.083594,0.036762,-0.165044,-0.071742,0.036762,-0.165518,-0.072453,0.034705,-0.150394,-0.084216,0.034705,-0.195622,-0.052164,0.037614,-0.196728,-0.053901,0.036762,-0.165044,-0.071742,0.036762,-0.196728,-0.053901,0.036762,-0.197186,-0.054621,0.034705,-0.165518,-0.072453,0.034705,-0.214708,-0.038522,0.037614,-0.216019,-0.040112,0.036762,-0.196728,-0.053901,0.036762,-0.216019,-0.040112,0.036762,-0.216562,-0.040771,0.034705,-0.197186,-0.054621,0.034705,-0.217851,-0.035542,0.037614,-0.221148,-0.035251,0.036762,-0.216019,-0.040112,0.036762,-0.221148,-0.035251,0.036762,-0.222513,-0.03513,0.034705,-0.216562,-0.040771,0.034705,-0.060403,0.021666,0.037614,-0.076883,0.014354,0.036762,-0.06213,0.023036,0.036762,-0.062846,0.023603,0.034705,-0.216562,-0.040771,0.034705,-0.004946,-0.030733,0.035104,-0.005756,-0.027991,0.037614,-0.012663,-0.031304,0.037614,0.004631,-0.032796,0.035104,0.004631,-0.032796,0.035104,0.008596,-0.040283,0.035104,0.010762,-0.039011,0.037614,0.007035,-0.048394,0.035104,0.008437,-0.05096,0.037614,0.010762,-0.039011,0.037614,-0.001507,-0.052694,0.035104,-0.000648,-0.055515,0.037614,0.008437,-0.05096,0.037614,-0.001507,-0.052694,0.035104,-0.010578,-0.050309,0.035104,-0.012211,-0.052475,0.037614,-0.015993,-0.041197,0.035104,-0.011877,-0.034071,0.035104,-0.012663,-0.031304,0.037614,-0.018651,-0.041637,0.037614,-0.010578,-0.050309,0.035104,-0.001507,-0.052694,0.035104,-0.00207,-0.049644,0.039021,0.005362,-0.040515,0.039021,-0.004599,-0.033489,0.039021,-0.010578,-0.050309,0.035104,-0.008743,-0.04789,0.039021,-0.012726,-0.041187,0.039021,0.007035,-0.048394,0.035104,0.004631,-0.032796,0.035104,0.002446,-0.035007,0.039021,0.005362,-0.040515,0.039021,-0.004946,-0.030733,0.035104,-0.004599,-0.033489,0.039021,-0.009698,-0.035945,0.039021,-0.011877,-0.034071,0.035104,-0.015993,-0.041197,0.035104,-0.012726,-0.041187,0.039021,0.038638,-0.162241,0.030907,0.020945,-0.160363,0.030907,0.002331,-0.163955,0.030907,-0.159699,-0.014336,0.030907,-0.136568,-0.012907,0.030907,-0.123316,-0.008679,0.030907,0.179657,0.150663,0.034705,-0.062846,0.023603,0.034705,0.109909,-0.019619,0.037614,0.11167,-0.030249,0.037614,0.172624,0.139671,0.037614,0.092646,0.06105,0.037614,0.091055,0.199724,0.037614,0.098426,-0.005106,0.037614,0.082264,0.011251,0.037614,0.061977,0.021668,0.037614,-0.002057,0.208884,0.037614,-0.060403,0.021666,0.037614,-0.05088,0.030645,0.037614,-0.031748,0.035906,0.037614,-0.012785,0.036583,0.037614,0.01689,0.096776,0.034705,0.093858,0.20895,0.034705,0.095476,0.06791,0.034705,-0.000999,0.222053,0.034705,-0.001309,0.218196,0.036762,-0.001309,0.218196,0.036762,-0.000999,0.222053,0.034705,-0.062846,0.023603,0.034705,0.015066,0.088977,0.037614,-0.001309,0.218196,0.036762,0.016356,0.094492,0.036762,0.01689,0.096776,0.034705,0.091055,0.199724,0.037614,0.093037,0.206248,0.036762,0.016356,0.094492,0.036762,0.093037,0.206248,0.036762,0.093858,0.20895,0.034705,0.01689,0.096776,0.034705,0.091055,0.199724,0.037614,0.092646,0.06105,0.037614,0.094647,0.065901,0.036762,0.093037,0.206248,0.036762,0.094647,0.065901,0.036762,0.095476,0.06791,0.034705,0.172624,0.139671,0.037614,0.177597,0.147444,0.036762,0.094647,0.065901,0.036762,0.177597,0.147444,0.036762,0.179657,0.150663,0.034705,0.095476,0.06791,0.034705,0.172624,0.139671,0.037614,0.11167,-0.030249,0.037614,0.113892,-0.030146,0.036762,0.177597,0.147444,0.036762,0.113892,-0.030146,0.036762,0.114812,-0.030103,0.034705,-0.004946,-0.030733,0.035104,-0.098885,-0.271685,0.030907,0.185843,0.221479,0.030907,-0.185844,0.221479,0.030907,-0.284729,0.050205,0.030907,-0.284729,-0.050206,0.030907,-0.250386,-0.144561,0.030907,-0.185844,-0.22148,0.030907,-0,-0.289121,0.030907,0.098885,-0.271685,0.030907,0.185843,-0.22148,0.030907,0.250386,-0.144561,0.030907,0.284728,-0.050206,0.030907,0.284728,0.050205,0.030907,0.250385,0.14456,0.030907,0.098885,0.271685,0.030907,-1e-06,0.289121,0.030907,-0.098886,0.271685,0.030907,-0.250387,0.14456,0.030907};
-const GLfloat coin_silver_normals[] = {-0.939693,0.34202,0,-0.939693,0.34202,0,-0.939693,0.34202,0,-0.766044,0.642787,0,-0.766044,0.642787,0,-0.766044,0.642787,0,-0.5,0.866025,0,-0.5,0.866025,0,-0.5,0.866025,0,-0.173648,0.984808,0,-0.173648,0.984808,0,-0.173648,0.984808,0,0.173649,0.984808,0,0.173649,0.984808,0,0.173649,0.984808,0,0.5,0.866025,0,0.5,0.866025,0,0.5,0.866025,0,0.766045,0.642787,0,0.766045,0.642787,0,0.766045,0.642787,0,0.939692,0.342021,0,0.939692,0.342021,0,0.939692,0.342021,0,1,1e-06,0,1,1e-06,0,1,1e-06,0,0.939693,-0.342019,0,0.939693,-0.342019,0,0.939693,-0.342019,0,0.766045,-0.642787,0,0.766045,-0.642787,0,0.766045,-0.642787,0,0.5,-0.866025,0,0.5,-0.866025,0,0.5,-0.866025,0,0.173648,-0.984808,0,0.173648,-0.984808,0,0.173648,-0.984808,0,-0.173648,-0.984808,-0,-0.173648,-0.984808,-0,-0.173648,-0.984808,-0,-0.939693,-0.34202,-0,-0.939693,-0.34202,-0,-0.939693,-0.34202,-0,-0.5,-0.866026,-0,-0.5,-0.866026,-0,-0.5,-0.866026,-0,0.766045,-0.642788,0,0.766045,-0.642788,0,0.766045,-0.642788,0,-0,0,1,-0,0,1,-0,0,1,0.766044,0.642788,-0,0.766044,0.642788,-0,0.766044,0.642788,-0,-0,-0,1,-0,-0,1,-0,-0,1,0,-0,1,0,-0,1,0,-0,1,-0,0,1,-0,0,1,-0,0,1,0,0,1,0,0,1,0,0,1,-0,0,1,-0,0,1,0,0,1,0,0,1,0,-0,1,0,-0,1,1,1e-06,-0,1,1e-06,-0,1,1e-06,-0,0.939693,-0.34202,0,0.939693,-0.34202,0,0.939693,-0.34202,0,0.5,-0.866026,0,0.5,-0.866026,0,0.5,-0.866026,0,0.173648,-0.984808,0,0.173648,-0.984808,0,0.173648,-0.984808,0,-0.173648,-0.984808,0,-0.173648,-0.984808,0,-0.173648,-0.984808,0,-0.5,-0.866025,0,-0.5,-0.866025,0,-0.5,-0.866025,0,-0.766044,-0.642788,0,-0.766044,-0.642788,0,-0.766044,-0.642788,0,-0.939692,-0.34202,0,-0.939692,-0.34202,0,-0.939692,-0.34202,0,-1,-1e-06,0,-1,-1e-06,0,-1,-1e-06,0,-0.939693,0.342019,0,-0.939693,0.342019,0,-0.939693,0.342019,0,-0.766045,0.642787,0,-0.766045,0.642787,0,-0.766045,0.642787,0,-0.500001,0.866025,0,-0.500001,0.866025,0,-0.500001,0.866025,0,-0.173648,0.984808,0,-0.173648,0.984808,0,-0.173648,0.984808,0,0.173648,0.984808,-0,0.173648,0.984808,-0,0.173648,0.984808,-0,-0.766044,-0.642788,-0,-0.766044,-0.642788,-0,-0.766044,-0.642788,-0,0.5,0.866026,-0,0.5,0.866026,-0,0.5,0.866026,-0,0,-0,1,0,-0,1,0,-0,1,0,-0,1,0,0,1,0,0,1,-0,0,1,-0,0,1,0,0,1,0,0,1,0,-0,1,0,0,1,-0,0,1,0,0,1,0.664464,0.241845,0.707106,0.664464,0.241845,0.707106,0.664464,0.241845,0.707106,0.707108,0,0.707106,0.707108,0,0.707106,0.707108,0,0.707106,0.66446,-0.241843,0.70711,0.66446,-0.241843,0.70711,0.66446,-0.241843,0.70711,0.541675,-0.454519,0.707107,0.541675,-0.454519,0.707107,0.541675,-0.454519,0.707107,0.353553,-0.612372,0.707107,0.353553,-0.612372,0.707107,0.353553,-0.612372,0.707107,0.122788,-0.696367,0.707104,0.122788,-0.696367,0.707104,0.122788,-0.696367,0.707104,-0.122789,-0.696368,0.707103,-0.122789,-0.696368,0.707103,-0.122789,-0.696368,0.707103,-0.353554,-0.612372,0.707107,-0.353554,-0.612372,0.707107,-0.353554,-0.612372,0.707107,-0.541675,-0.45452,0.707106,-0.541675,-0.45452,0.707106,-0.541675,-0.45452,0.707106,-0.664464,-0.241845,0.707105,-0.664464,-0.241845,0.707105,-0.664464,-0.241845,0.707105,-0.707108,-0,0.707106,-0.707108,-0,0.707106,-0.707108,-0,0.707106,-0.664464,0.241845,0.707106,-0.664464,0.241845,0.707106,-0.664464,0.241845,0.707106,-0.541676,0.454519,0.707107,-0.541676,0.454519,0.707107,-0.541676,0.454519,0.707107,-0.353554,0.612372,0.707107,-0.353554,0.612372,0.707107,-0.353554,0.612372,0.707107,-0.122788,0.696363,0.707108,-0.122788,0.696363,0.707108,-0.122788,0.696363,0.707108,0.122787,0.696364,0.707107,0.122787,0.696364,0.707107,0.122787,0.696364,0.707107,0.353555,0.612376,0.707103,0.353555,0.612376,0.707103,0.353555,0.612376,0.707103,0.541673,0.454517,0.70711,0.541673,0.454517,0.70711,0.541673,0.454517,0.70711,0.939693,0.34202,-0,0.939693,0.34202,-0,0.939693,0.34202,-0,-0.907672,-0.330366,0.258826,-0.907672,-0.330366,0.258826,-0.907672,-0.330366,0.258826,-0.664462,-0.241844,0.707108,-0.664462,-0.241844,0.707108,-0.664462,-0.241844,0.707108,-0.243212,-0.088522,0.965925,-0.243212,-0.088522,0.965925,-0.243212,-0.088522,0.965925,-0.965927,-1e-06,0.258815,-0.965927,-1e-06,0.258815,-0.965927,-1e-06,0.258815,-0.707113,-0,0.707101,-0.707113,-0,0.707101,-0.707113,-0,0.707101,-0.258814,-0,0.965927,-0.258814,-0,0.965927,-0.258814,-0,0.965927,-0.907675,0.330366,0.258813,-0.907675,0.330366,0.258813,-0.907675,0.330366,0.258813,-0.664462,0.241844,0.707108,-0.664462,0.241844,0.707108,-0.664462,0.241844,0.707108,-0.243208,0.08852,0.965926,-0.243208,0.08852,0.965926,-0.243208,0.08852,0.965926,-0.739943,0.620885,0.258817,-0.739943,0.620885,0.258817,-0.739943,0.620885,0.258817,-0.541678,0.454522,0.707103,-0.541678,0.454522,0.707103,-0.541678,0.454522,0.707103,-0.198267,0.166365,0.965926,-0.198267,0.166365,0.965926,-0.198267,0.166365,0.965926,-0.482962,0.836514,0.258828,-0.482962,0.836514,0.258828,-0.482962,0.836514,0.258828,-0.353555,0.612376,0.707103,-0.353555,0.612376,0.707103,-0.353555,0.612376,0.707103,-0.12941,0.224144,0.965926,-0.12941,0.224144,0.965926,-0.12941,0.224144,0.965926,-0.167731,0.95125,0.258823,-0.167731,0.95125,0.258823,-0.167731,0.95125,0.258823,-0.122787,0.696361,0.70711,-0.122787,0.696361,0.70711,-0.122787,0.696361,0.70711,-0.044943,0.254888,0.965926,-0.044943,0.254888,0.965926,-0.044943,0.254888,0.965926,0.167732,0.951255,0.258804,0.167732,0.951255,0.258804,0.167732,0.951255,0.258804,0.122788,0.696369,0.707102,0.122788,0.696369,0.707102,0.122788,0.696369,0.707102,0.044942,0.254881,0.965928,0.044942,0.254881,0.965928,0.044942,0.254881,0.965928,0.482962,0.836514,0.258828,0.482962,0.836514,0.258828,0.482962,0.836514,0.258828,0.353553,0.612371,0.707108,0.353553,0.612371,0.707108,0.353553,0.612371,0.707108,0.129411,0.224146,0.965925,0.129411,0.224146,0.965925,0.129411,0.224146,0.965925,0.73994,0.620883,0.25883,0.73994,0.620883,0.25883,0.73994,0.620883,0.25883,0.541674,0.454518,0.707108,0.541674,0.454518,0.707108,0.541674,0.454518,0.707108,0.198269,0.166367,0.965925,0.198269,0.166367,0.965925,0.198269,0.166367,0.965925,0.907675,0.330367,0.258813,0.907675,0.330367,0.258813,0.907675,0.330367,0.258813,0.664462,0.241845,0.707107,0.664462,0.241845,0.707107,0.664462,0.241845,0.707107,0.243211,0.088522,0.965926,0.243211,0.088522,0.965926,0.243211,0.088522,0.965926,0.965924,1e-06,0.258828,0.965924,1e-06,0.258828,0.965924,1e-06,0.258828,0.707113,0,0.707101,0.707113,0,0.707101,0.707113,0,0.707101,0.25882,0,0.965925,0.25882,0,0.965925,0.25882,0,0.965925,0.907675,-0.330366,0.258812,0.907675,-0.330366,0.258812,0.907675,-0.330366,0.258812,0.664456,-0.241842,0.707114,0.664456,-0.241842,0.707114,0.664456,-0.241842,0.707114,0.243211,-0.088522,0.965926,0.243211,-0.088522,0.965926,0.243211,-0.088522,0.965926,0.739944,-0.620886,0.25881,0.739944,-0.620886,0.25881,0.739944,-0.620886,0.25881,0.541673,-0.454517,0.70711,0.541673,-0.454517,0.70711,0.541673,-0.454517,0.70711,0.198267,-0.166365,0.965926,0.198267,-0.166365,0.965926,0.198267,-0.166365,0.965926,0.482962,-0.836514,0.258828,0.482962,-0.836514,0.258828,0.482962,-0.836514,0.258828,0.353555,-0.612376,0.707103,0.353555,-0.612376,0.707103,0.353555,-0.612376,0.707103,0.12941,-0.224145,0.965925,0.12941,-0.224145,0.965925,0.12941,-0.224145,0.965925,0.167732,-0.951253,0.258811,0.167732,-0.951253,0.258811,0.167732,-0.951253,0.258811,0.122788,-0.69636,0.707111,0.122788,-0.69636,0.707111,0.122788,-0.69636,0.707111,0.044944,-0.254888,0.965926,0.044944,-0.254888,0.965926,0.044944,-0.254888,0.965926,-0.167732,-0.951256,0.258803,-0.167732,-0.951256,0.258803,-0.167732,-0.951256,0.258803,-0.122786,-0.696355,0.707116,-0.122786,-0.696355,0.707116,-0.122786,-0.696355,0.707116,-0.044944,-0.254888,0.965926,-0.044944,-0.254888,0.965926,-0.044944,-0.254888,0.965926,-0.482962,-0.836515,0.258826,-0.482962,-0.836515,0.258826,-0.482962,-0.836515,0.258826,-0.353553,-0.612373,0.707106,-0.353553,-0.612373,0.707106,-0.353553,-0.612373,0.707106,-0.12941,-0.224145,0.965926,-0.12941,-0.224145,0.965926,-0.12941,-0.224145,0.965926,-0.73994,-0.620884,0.258826,-0.73994,-0.620884,0.258826,-0.73994,-0.620884,0.258826,-0.541674,-0.454519,0.707108,-0.541674,-0.454519,0.707108,-0.541674,-0.454519,0.707108,-0.198269,-0.166367,0.965925,-0.198269,-0.166367,0.965925,-0.198269,-0.166367,0.965925,-0,-0,1,-0.907671,-0.330366,-0.258827,-0.907671,-0.330366,-0.258827,-0.907671,-0.330366,-0.258827,-0.664464,-0.241845,-0.707106,-0.664464,-0.241845,-0.707106,-0.664464,-0.241845,-0.707106,-0.243211,-0.088522,-0.965926,-0.243211,-0.088522,-0.965926,-0.243211,-0.088522,-0.965926,-0.965924,-0,-0.258826,-0.965924,-0,-0.258826,-0.965924,-0,-0.258826,-0.707106,-0,-0.707107,-0.707106,-0,-0.707107,-0.707106,-0,-0.707107,-0.258819,-0,-0.965926,-0.258819,-0,-0.965926,-0.258819,-0,-0.965926,-0.907674,0.330366,-0.258818,-0.907674,0.330366,-0.258818,-0.907674,0.330366,-0.258818,-0.664463,0.241844,-0.707107,-0.664463,0.241844,-0.707107,-0.664463,0.241844,-0.707107,-0.243211,0.088521,-0.965926,-0.243211,0.088521,-0.965926,-0.243211,0.088521,-0.965926,-0.739943,0.620886,-0.258815,-0.739943,0.620886,-0.258815,-0.739943,0.620886,-0.258815,-0.541676,0.45452,-0.707106,-0.541676,0.45452,-0.707106,-0.541676,0.45452,-0.707106,-0.198266,0.166365,-0.965926,-0.198266,0.166365,-0.965926,-0.198266,0.166365,-0.965926,-0.482961,0.836513,-0.258831,-0.482961,0.836513,-0.258831,-0.482961,0.836513,-0.258831,-0.353557,0.612379,-0.7071,-0.353557,0.612379,-0.7071,-0.353557,0.612379,-0.7071,-0.12941,0.224144,-0.965926,-0.12941,0.224144,-0.965926,-0.12941,0.224144,-0.965926,-0.167731,0.951253,-0.258811,-0.167731,0.951253,-0.258811,-0.167731,0.951253,-0.258811,-0.122787,0.69636,-0.707111,-0.122787,0.69636,-0.707111,-0.122787,0.69636,-0.707111,-0.044943,0.254885,-0.965927,-0.044943,0.254885,-0.965927,-0.044943,0.254885,-0.965927,0.167732,0.951251,-0.258819,0.167732,0.951251,-0.258819,0.167732,0.951251,-0.258819,0.122788,0.696366,-0.707105,0.122788,0.696366,-0.707105,0.122788,0.696366,-0.707105,0.044943,0.254885,-0.965926,0.044943,0.254885,-0.965926,0.044943,0.254885,-0.965926,0.482965,0.836518,-0.25881,0.482965,0.836518,-0.25881,0.482965,0.836518,-0.25881,0.353554,0.612372,-0.707107,0.353554,0.612372,-0.707107,0.353554,0.612372,-0.707107,0.129409,0.224144,-0.965926,0.129409,0.224144,-0.965926,0.129409,0.224144,-0.965926,0.73994,0.620883,-0.25883,0.73994,0.620883,-0.25883,0.73994,0.620883,-0.25883,0.541677,0.454521,-0.707104,0.541677,0.454521,-0.707104,0.541677,0.454521,-0.707104,0.198268,0.166366,-0.965926,0.198268,0.166366,-0.965926,0.198268,0.166366,-0.965926,0.907673,0.330366,-0.25882,0.907673,0.330366,-0.25882,0.907673,0.330366,-0.25882,0.664464,0.241846,-0.707106,0.664464,0.241846,-0.707106,0.664464,0.241846,-0.707106,0.243209,0.088521,-0.965926,0.243209,0.088521,-0.965926,0.243209,0.088521,-0.965926,0.965926,1e-06,-0.258817,0.965926,1e-06,-0.258817,0.965926,1e-06,-0.258817,0.707106,0,-0.707107,0.707106,0,-0.707107,0.707106,0,-0.707107,0.258817,0,-0.965926,0.258817,0,-0.965926,0.258817,0,-0.965926,0.907674,-0.330366,-0.258818,0.907674,-0.330366,-0.258818,0.907674,-0.330366,-0.258818,0.664464,-0.241845,-0.707106,0.664464,-0.241845,-0.707106,0.664464,-0.241845,-0.707106,0.243212,-0.088522,-0.965926,0.243212,-0.088522,-0.965926,0.243212,-0.088522,-0.965926,0.739941,-0.620884,-0.258825,0.739941,-0.620884,-0.258825,0.739941,-0.620884,-0.258825,0.541678,-0.454521,-0.707103,0.541678,-0.454521,-0.707103,0.541678,-0.454521,-0.707103,0.198265,-0.166364,-0.965927,0.198265,-0.166364,-0.965927,0.198265,-0.166364,-0.965927,0.482962,-0.836513,-0.258831,0.482962,-0.836513,-0.258831,0.482962,-0.836513,-0.258831,0.353557,-0.612378,-0.7071,0.353557,-0.612378,-0.7071,0.353557,-0.612378,-0.7071,0.12941,-0.224144,-0.965926,0.12941,-0.224144,-0.965926,0.12941,-0.224144,-0.965926,0.167732,-0.951253,-0.258811,0.167732,-0.951253,-0.258811,0.167732,-0.951253,-0.258811,0.122788,-0.696364,-0.707107,0.122788,-0.696364,-0.707107,0.122788,-0.696364,-0.707107,0.044943,-0.254884,-0.965927,0.044943,-0.254884,-0.965927,0.044943,-0.254884,-0.965927,-0.167731,-0.951251,-0.258819,-0.167731,-0.951251,-0.258819,-0.167731,-0.951251,-0.258819,-0.122788,-0.696366,-0.707105,-0.122788,-0.696366,-0.707105,-0.122788,-0.696366,-0.707105,-0.044943,-0.254888,-0.965926,-0.044943,-0.254888,-0.965926,-0.044943,-0.254888,-0.965926,-0.482963,-0.836516,-0.258819,-0.482963,-0.836516,-0.258819,-0.482963,-0.836516,-0.258819,-0.353554,-0.612374,-0.707105,-0.353554,-0.612374,-0.707105,-0.353554,-0.612374,-0.707105,-0.129409,-0.224144,-0.965926,-0.129409,-0.224144,-0.965926,-0.129409,-0.224144,-0.965926,-0.739939,-0.620883,-0.258832,-0.739939,-0.620883,-0.258832,-0.739939,-0.620883,-0.258832,-0.541679,-0.454523,-0.707102,-0.541679,-0.454523,-0.707102,-0.541679,-0.454523,-0.707102,-0.198268,-0.166367,-0.965925,-0.198268,-0.166367,-0.965925,-0.198268,-0.166367,-0.965925,-1,-0,-0,-1,-0,-0,-1,-0,-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-0.586069,-0.810261,0,-0.586069,-0.810261,0,-0.586069,-0.810261,0,-0.297134,0.954836,0,-0.297134,0.954836,0,-0.297134,0.954836,0,-0.453888,-0.891059,0,-0.453888,-0.891059,0,-0.453888,-0.891059,0,-0.317928,-0.948115,0,-0.317928,-0.948115,0,-0.317928,-0.948115,0,-0.082546,0.996587,0,-0.082546,0.996587,0,-0.082546,0.996587,0,-0.10556,-0.994413,0,-0.10556,-0.994413,0,-0.10556,-0.994413,0,-0.061654,0.998098,0,-0.061654,0.998098,0,-0.061654,0.998098,0,0.189497,-0.981881,0,0.189497,-0.981881,0,0.189497,-0.981881,0,-0.303945,0.952689,0,-0.303945,0.952689,0,-0.303945,0.952689,0,0,-0,1,0,-0,1,0,-0,1,0.310469,-0.950583,0,0.310469,-0.950583,0,0.310469,-0.950583,0,-0.39898,0.916959,0,-0.39898,0.916959,0,-0.39898,0.916959,0,0.434419,-0.900711,0,0.434419,-0.900711,0,0.434419,-0.900711,0,-0.503534,0.863976,0,-0.503534,0.863976,0,-0.503534,0.863976,0,0.530485,-0.847695,0,0.530485,-0.847695,0,0.530485,-0.847695,0,-0.507184,0.861838,0,-0.507184,0.861838,0,-0.507184,0.861838,0,0.263968,-0.964531,0,0.263968,-0.964531,0,0.263968,-0.964531,0,-0.083608,-0.996499,0,-0.083608,-0.996499,0,-0.083608,-0.996499,0,0.905821,0.42366,-0,0.905821,0.42366,-0,0.905821,0.42366,-0,-0.548497,-0.836152,0,-0.548497,-0.836152,0,-0.548497,-0.836152,0,-0.749817,-0.661646,0,-0.749817,-0.661646,0,-0.749817,-0.661646,0,-0.87845,-0.477835,0,-0.87845,-0.477835,0,-0.87845,-0.477835,0,-0.933111,-0.359589,0,-0.933111,-0.359589,0,-0.933111,-0.359589,0,-0.971901,-0.235391,0,-0.971901,-0.235391,0,-0.971901,-0.235391,0,0.955685,0.294392,-0,0.955685,0.294392,-0,0.955685,0.294392,-0,-0.903119,-0.429389,0,-0.903119,-0.429389,0,-0.903119,-0.429389,0,-0.755136,-0.655568,0,-0.755136,-0.655568,0,-0.755136,-0.655568,0,-0.61393,-0.78936,0,-0.61393,-0.78936,0,-0.61393,-0.78936,0,-0.490653,-0.871355,0,-0.490653,-0.871355,0,-0.490653,-0.871355,0,0.97736,0.211582,-0,0.97736,0.211582,-0,0.97736,0.211582,-0,-0.581499,-0.813547,0,-0.581499,-0.813547,0,-0.581499,-0.813547,0,0.98353,0.180742,-0,0.98353,0.180742,-0,0.98353,0.180742,-0,0.987192,-0.159535,0,0.987192,-0.159535,0,0.987192,-0.159535,0,-0.54999,0.835171,0,-0.54999,0.835171,0,-0.54999,0.835171,0,0.92873,-0.370757,0,0.92873,-0.370757,0,0.92873,-0.370757,0,0.685661,-0.727921,0,0.685661,-0.727921,0,0.685661,-0.727921,0,0.259319,-0.965792,0,0.259319,-0.965792,0,0.259319,-0.965792,0,0,0,1,0,0,1,0,0,1,-0.174577,-0.984644,0,-0.174577,-0.984644,0,-0.174577,-0.984644,0,-0.586068,-0.810262,0,-0.586068,-0.810262,0,-0.586068,-0.810262,0,-0.210473,0.319607,0.923879,-0.210473,0.319607,0.923879,-0.210473,0.319607,0.923879,-0.508123,0.771595,0.382691,-0.508123,0.771595,0.382691,-0.508123,0.771595,0.382691,-0.113708,0.365401,0.923879,-0.113708,0.365401,0.923879,-0.113708,0.365401,0.923879,-0.274516,0.882153,0.382684,-0.274516,0.882153,0.382684,-0.274516,0.882153,0.382684,-0.03159,0.381381,0.923878,-0.03159,0.381381,0.923878,-0.03159,0.381381,0.923878,-0.076262,0.920722,0.382694,-0.076262,0.920722,0.382694,-0.076262,0.920722,0.382694,-0.023594,0.381954,0.92388,-0.023594,0.381954,0.92388,-0.023594,0.381954,0.92388,-0.056961,0.922123,0.382682,-0.056961,0.922123,0.382682,-0.056961,0.922123,0.382682,-0.116315,0.364578,0.92388,-0.116315,0.364578,0.92388,-0.116315,0.364578,0.92388,-0.28081,0.880169,0.382686,-0.28081,0.880169,0.382686,-0.28081,0.880169,0.382686,-0.152682,0.350904,0.92388,-0.152682,0.350904,0.92388,-0.152682,0.350904,0.92388,-0.36861,0.847161,0.382681,-0.36861,0.847161,0.382681,-0.36861,0.847161,0.382681,-0.192694,0.330629,0.923879,-0.192694,0.330629,0.923879,-0.192694,0.330629,0.923879,-0.465204,0.798209,0.382685,-0.465204,0.798209,0.382685,-0.465204,0.798209,0.382685,0.346642,0.162128,0.92388,0.346642,0.162128,0.92388,0.346642,0.162128,0.92388,0.836869,0.391411,0.382686,0.836869,0.391411,0.382686,0.836869,0.391411,0.382686,0.365727,0.112659,0.923879,0.365727,0.112659,0.923879,0.365727,0.112659,0.923879,0.882937,0.271982,0.382685,0.882937,0.271982,0.382685,0.882937,0.271982,0.382685,0.374021,0.080968,0.923879,0.374021,0.080968,0.923879,0.374021,0.080968,0.923879,0.90296,0.195475,0.382691,0.90296,0.195475,0.382691,0.90296,0.195475,0.382691,0.376412,0.069169,0.923867,0.376412,0.069169,0.923867,0.376412,0.069169,0.923867,0.908673,0.166984,0.38266,0.908673,0.166984,0.38266,0.908673,0.166984,0.38266,0.377777,-0.061051,0.923882,0.377777,-0.061051,0.923882,0.377777,-0.061051,0.923882,0.912049,-0.147392,0.382679,0.912049,-0.147392,0.382679,0.912049,-0.147392,0.382679,0.355409,-0.141882,0.92388,0.355409,-0.141882,0.92388,0.355409,-0.141882,0.92388,0.858034,-0.342534,0.382686,0.858034,-0.342534,0.382686,0.858034,-0.342534,0.382686,0.262392,-0.278564,0.923879,0.262392,-0.278564,0.923879,0.262392,-0.278564,0.923879,0.633469,-0.672513,0.38268,0.633469,-0.672513,0.38268,0.633469,-0.672513,0.38268,0.099237,-0.369593,0.923879,0.099237,-0.369593,0.923879,0.099237,-0.369593,0.923879,0.23958,-0.892278,0.382678,0.23958,-0.892278,0.382678,0.23958,-0.892278,0.382678,-0.066808,-0.376808,0.923879,-0.066808,-0.376808,0.923879,-0.066808,-0.376808,0.923879,-0.161286,-0.909691,0.382687,-0.161286,-0.909691,0.382687,-0.161286,-0.909691,0.382687,-0.224279,-0.310074,0.92388,-0.224279,-0.310074,0.92388,-0.224279,-0.310074,0.92388,-0.541458,-0.748587,0.382677,-0.541458,-0.748587,0.382677,-0.541458,-0.748587,0.382677,-0.22428,-0.310074,0.923879,-0.22428,-0.310074,0.923879,-0.22428,-0.310074,0.923879,-0.541457,-0.748584,0.382683,-0.541457,-0.748584,0.382683,-0.541457,-0.748584,0.382683,-0.173696,-0.340995,0.923879,-0.173696,-0.340995,0.923879,-0.173696,-0.340995,0.923879,-0.419336,-0.823228,0.382691,-0.419336,-0.823228,0.382691,-0.419336,-0.823228,0.382691,-0.121666,-0.362828,0.923879,-0.121666,-0.362828,0.923879,-0.121666,-0.362828,0.923879,-0.293728,-0.875945,0.382681,-0.293728,-0.875945,0.382681,-0.293728,-0.875945,0.382681,-0.040396,-0.380546,0.923879,-0.040396,-0.380546,0.923879,-0.040396,-0.380546,0.923879,-0.097525,-0.918718,0.382683,-0.097525,-0.918718,0.382683,-0.097525,-0.918718,0.382683,0.072517,-0.375747,0.923881,0.072517,-0.375747,0.923881,0.072517,-0.375747,0.923881,0.175072,-0.907139,0.382686,0.175072,-0.907139,0.382686,0.175072,-0.907139,0.382686,0.118812,-0.363773,0.923879,0.118812,-0.363773,0.923879,0.118812,-0.363773,0.923879,0.286836,-0.878223,0.382686,0.286836,-0.878223,0.382686,0.286836,-0.878223,0.382686,0.166245,-0.344687,0.92388,0.166245,-0.344687,0.92388,0.166245,-0.344687,0.92388,0.40135,-0.832148,0.382684,0.40135,-0.832148,0.382684,0.40135,-0.832148,0.382684,0.203009,-0.3244,0.923879,0.203009,-0.3244,0.923879,0.203009,-0.3244,0.923879,0.490103,-0.783165,0.38269,0.490103,-0.783165,0.38269,0.490103,-0.783165,0.38269,0.101016,-0.36911,0.923879,0.101016,-0.36911,0.923879,0.101016,-0.36911,0.923879,0.243875,-0.891111,0.382683,0.243875,-0.891111,0.382683,0.243875,-0.891111,0.382683,-0.031996,-0.381343,0.92388,-0.031996,-0.381343,0.92388,-0.031996,-0.381343,0.92388,-0.077245,-0.920645,0.382682,-0.077245,-0.920645,0.382682,-0.077245,-0.920645,0.382682,-0.209901,-0.319982,0.923879,-0.209901,-0.319982,0.923879,-0.209901,-0.319982,0.923879,-0.506745,-0.772504,0.382684,-0.506745,-0.772504,0.382684,-0.506745,-0.772504,0.382684,-0.28694,-0.253198,0.923881,-0.28694,-0.253198,0.923881,-0.28694,-0.253198,0.923881,-0.69274,-0.611281,0.382684,-0.69274,-0.611281,0.382684,-0.69274,-0.611281,0.382684,-0.33617,-0.182861,0.923878,-0.33617,-0.182861,0.923878,-0.33617,-0.182861,0.923878,-0.81158,-0.441461,0.382688,-0.81158,-0.441461,0.382688,-0.81158,-0.441461,0.382688,-0.357087,-0.13761,0.923879,-0.357087,-0.13761,0.923879,-0.357087,-0.13761,0.923879,-0.862082,-0.332217,0.382684,-0.862082,-0.332217,0.382684,-0.862082,-0.332217,0.382684,-0.371926,-0.090079,0.923881,-0.371926,-0.090079,0.923881,-0.371926,-0.090079,0.923881,-0.897921,-0.217473,0.382679,-0.897921,-0.217473,0.382679,-0.897921,-0.217473,0.382679,-0.34561,-0.164321,0.923879,-0.34561,-0.164321,0.923879,-0.34561,-0.164321,0.923879,-0.834373,-0.396704,0.382685,-0.834373,-0.396704,0.382685,-0.834373,-0.396704,0.382685,-0.28898,-0.250876,0.923878,-0.28898,-0.250876,0.923878,-0.28898,-0.250876,0.923878,-0.697654,-0.605665,0.382685,-0.697654,-0.605665,0.382685,-0.697654,-0.605665,0.382685,-0.234939,-0.302073,0.923881,-0.234939,-0.302073,0.923881,-0.234939,-0.302073,0.923881,-0.567199,-0.729274,0.382681,-0.567199,-0.729274,0.382681,-0.567199,-0.729274,0.382681,-0.187765,-0.333454,0.923879,-0.187765,-0.333454,0.923879,-0.187765,-0.333454,0.923879,-0.453304,-0.805026,0.382685,-0.453304,-0.805026,0.382685,-0.453304,-0.805026,0.382685,-0.222532,-0.311333,0.923878,-0.222532,-0.311333,0.923878,-0.222532,-0.311333,0.923878,-0.537234,-0.751619,0.382686,-0.537234,-0.751619,0.382686,-0.537234,-0.751619,0.382686,-0.263261,-0.277739,0.92388,-0.263261,-0.277739,0.92388,-0.263261,-0.277739,0.92388,-0.635573,-0.670523,0.382683,-0.635573,-0.670523,0.382683,-0.635573,-0.670523,0.382683,-0.194091,0.329812,0.923879,-0.194091,0.329812,0.923879,-0.194091,0.329812,0.923879,-0.468577,0.796235,0.382682,-0.468577,0.796235,0.382682,-0.468577,0.796235,0.382682,-0.687937,-0.725771,0,-0.687937,-0.725771,0,-0.687937,-0.725771,0,0.287719,-0.597291,0.74864,0.287719,-0.597291,0.74864,0.287719,-0.597291,0.74864,-0.148946,-0.691242,0.707107,-0.148946,-0.691242,0.707107,-0.148946,-0.691242,0.707107,-0.624904,-0.330901,0.707107,-0.624904,-0.330901,0.707107,-0.624904,-0.330901,0.707107,-0.784874,0.151071,0.600958,-0.784874,0.151071,0.600958,-0.784874,0.151071,0.600958,-0.292926,0.581947,0.758638,-0.292926,0.581947,0.758638,-0.292926,0.581947,0.758638,0.179808,0.683863,0.707107,0.179808,0.683863,0.707107,0.179808,0.683863,0.707107,0.607877,0.361228,0.707107,0.607877,0.361228,0.707107,0.607877,0.361228,0.707107,0.66647,-0.385011,0.638423,0.66647,-0.385011,0.638423,0.66647,-0.385011,0.638423,-0.206701,-0.786147,0.582449,-0.206701,-0.786147,0.582449,-0.206701,-0.786147,0.582449,0.766948,-0.14762,0.624499,0.766948,-0.14762,0.624499,0.766948,-0.14762,0.624499,0.175043,0.812357,0.55627,0.175043,0.812357,0.55627,0.175043,0.812357,0.55627,-0.698159,-0.414877,0.583482,-0.698159,-0.414877,0.583482,-0.698159,-0.414877,0.583482,0.357947,-0.711122,0.605127,0.357947,-0.711122,0.605127,0.357947,-0.711122,0.605127,0.704509,0.373054,0.603736,0.704509,0.373054,0.603736,0.704509,0.373054,0.603736,0.360122,-0.747596,-0.558043,0.360122,-0.747596,-0.558043,0.360122,-0.747596,-0.558043,-0.702348,0.405737,0.58488,-0.702348,0.405737,0.58488,-0.702348,0.405737,0.58488,0.189281,-0.392939,-0.899873,0.189281,-0.392939,-0.899873,0.189281,-0.392939,-0.899873,-0.408677,0.236087,0.881616,-0.408677,0.236087,0.881616,-0.408677,0.236087,0.881616,-0.089082,-0.338804,0.93663,-0.089082,-0.338804,0.93663,-0.089082,-0.338804,0.93663,0.229984,-0.044267,0.972187,0.229984,-0.044267,0.972187,0.229984,-0.044267,0.972187,0.073226,0.339836,0.93763,0.073226,0.339836,0.93763,0.073226,0.339836,0.93763,-0.384107,-0.228254,0.894629,-0.384107,-0.228254,0.894629,-0.384107,-0.228254,0.894629,0.121885,-0.242146,0.962553,0.121885,-0.242146,0.962553,0.121885,-0.242146,0.962553,0.225127,0.11921,0.967009,0.225127,0.11921,0.967009,0.225127,0.11921,0.967009,0.941271,-0.337653,0,0.941271,-0.337653,0,0.941271,-0.337653,0,-0.954711,0.297534,0,-0.954711,0.297534,0,-0.954711,0.297534,0,0,0,1,0,0,1,0,0,1,-0.824561,0.565773,0,-0.824561,0.565773,0,-0.824561,0.565773,0,0.999934,0.011472,-0,0.999934,0.011472,-0,0.999934,0.011472,-0,-0.701034,0.713128,0,-0.701034,0.713128,0,-0.701034,0.713128,0,0.989958,0.141365,-0,0.989958,0.141365,-0,0.989958,0.141365,-0,-0.365354,0.113862,0.923879,-0.365354,0.113862,0.923879,-0.365354,0.113862,0.923879,-0.882037,0.274885,0.382687,-0.882037,0.274885,0.382687,-0.882037,0.274885,0.382687,0.378841,0.054098,0.923879,0.378841,0.054098,0.923879,0.378841,0.054098,0.923879,0.9146,0.130604,0.382688,0.9146,0.130604,0.382688,0.9146,0.130604,0.382688,-0.315547,0.216513,0.923879,-0.315547,0.216513,0.923879,-0.315547,0.216513,0.923879,-0.761795,0.522706,0.382685,-0.761795,0.522706,0.382685,-0.761795,0.522706,0.382685,0.382657,0.00439,0.92388,0.382657,0.00439,0.92388,0.382657,0.00439,0.92388,0.923819,0.010599,0.382683,0.923819,0.010599,0.382683,0.923819,0.010599,0.382683,-0.268274,0.272903,0.923879,-0.268274,0.272903,0.923879,-0.268274,0.272903,0.923879,-0.64767,0.658844,0.382685,-0.64767,0.658844,0.382685,-0.64767,0.658844,0.382685,0.360208,-0.129214,0.92388,0.360208,-0.129214,0.92388,0.360208,-0.129214,0.92388,0.86962,-0.311951,0.382686,0.86962,-0.311951,0.382686,0.86962,-0.311951,0.382686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-0.939693,0.34202,0,-0.939693,0.34202,0,-0.939693,0.34202,0,-0.766044,0.642787,0,-0.766044,0.642788,0,-0.766044,0.642788,0,-0.766044,0.642788,0,-0.766044,0.642788,0,-0.5,0.866025,0,-0.5,0.866025,0,-0.5,0.866025,0,-0.173648,0.984808,0,-0.173648,0.984808,0,-0.173648,0.984808,0,0.173649,0.984808,-0,0.173649,0.984808,-0,0.173649,0.984808,0,0.5,0.866025,-0,0.5,0.866025,-0,0.5,0.866025,0,0.766045,0.642787,-0,0.766045,0.642787,-0,0.766045,0.642787,0,0.939692,0.342021,-0,0.939692,0.342021,-0,0.939692,0.342021,0,1,1e-06,-0,1,1e-06,-0,1,1e-06,0,0.939693,-0.342019,0,0.939693,-0.342019,0,0.939693,-0.342019,0,0.766045,-0.642787,0,0.766045,-0.642787,0,0.766045,-0.642787,0,0.5,-0.866025,0,0.5,-0.866025,0,0.5,-0.866025,0,0.173648,-0.984808,0,0.173648,-0.984808,0,0.173648,-0.984808,0,-0.173648,-0.984808,0,-0.173648,-0.984808,0,-0.173648,-0.984808,-0,-0.939693,-0.34202,0,-0.939693,-0.34202,0,-0.939693,-0.34202,-0,-0.5,-0.866026,0,-0.5,-0.866026,0,-0.5,-0.866026,-0,0.766045,-0.642788,0,0.766044,0.642788,0,1,1e-06,0,0.939693,-0.34202,0,0.5,-0.866026,0,0.173648,-0.984808,0,-0.173648,-0.984808,-0,-0.5,-0.866025,-0,-0.766044,-0.642788,-0,-0.939692,-0.34202,-0,-1,-1e-06,-0,-0.939693,0.342019,0,-0.766045,0.642787,0,-0.500001,0.866025,0,-0.173648,0.984808,0,0.173648,0.984808,0,-0.766044,-0.642788,0,-0.766044,-0.642788,0,-0.766044,-0.642788,-0,0.5,0.866026,0,0.66446,0.241844,0.70711,0.66446,0.241844,0.70711,0.66446,0.241844,0.70711,0.707108,0,0.707106,0.664464,-0.241845,0.707106,0.664464,-0.241845,0.707106,0.664464,-0.241845,0.707106,0.541674,-0.454518,0.707109,0.541674,-0.454518,0.707109,0.541674,-0.454518,0.707109,0.353553,-0.612373,0.707106,0.353553,-0.612373,0.707106,0.353553,-0.612373,0.707106,0.122788,-0.696363,0.707108,0.122788,-0.696363,0.707108,0.122788,-0.696363,0.707108,-0.122789,-0.696367,0.707104,-0.122789,-0.696367,0.707104,-0.122789,-0.696367,0.707104,-0.353556,-0.612376,0.707102,-0.353556,-0.612376,0.707102,-0.353556,-0.612376,0.707102,-0.541675,-0.454519,0.707107,-0.541675,-0.454519,0.707107,-0.541675,-0.454519,0.707107,-0.664464,-0.241845,0.707106,-0.664464,-0.241845,0.707106,-0.664464,-0.241845,0.707106,-0.707108,-0,0.707106,-0.664464,0.241844,0.707106,-0.664464,0.241844,0.707106,-0.664464,0.241844,0.707106,-0.541677,0.45452,0.707105,-0.541677,0.45452,0.707105,-0.541677,0.45452,0.707105,-0.353554,0.612372,0.707107,-0.122788,0.696363,0.707108,0.122787,0.696363,0.707108,0.122787,0.696363,0.707108,0.122787,0.696363,0.707108,0.353553,0.612373,0.707106,0.353553,0.612373,0.707106,0.353553,0.612373,0.707106,0.541677,0.454522,0.707104,0.541677,0.454522,0.707104,0.541677,0.454522,0.707104,0.939693,0.34202,0,-0.907671,-0.330365,0.258827,-0.907671,-0.330365,0.258827,-0.907671,-0.330365,0.258827,-0.664462,-0.241844,0.707108,-0.243212,-0.088522,0.965925,-0.965923,-0,0.258828,-0.965923,-0,0.258828,-0.965923,-0,0.258828,-0.707106,-1e-06,0.707108,-0.707106,-1e-06,0.707108,-0.707106,-1e-06,0.707108,-0.25882,-0,0.965925,-0.25882,-0,0.965925,-0.25882,-0,0.965925,-0.907674,0.330366,0.258816,-0.907674,0.330366,0.258816,-0.907674,0.330366,0.258816,-0.664469,0.241847,0.707101,-0.664469,0.241847,0.707101,-0.664469,0.241847,0.707101,-0.243205,0.088519,0.965927,-0.243205,0.088519,0.965927,-0.243205,0.088519,0.965927,-0.739943,0.620886,0.258813,-0.739943,0.620886,0.258813,-0.739943,0.620886,0.258813,-0.541674,0.454518,0.707108,-0.541674,0.454518,0.707108,-0.541674,0.454518,0.707108,-0.198265,0.166364,0.965926,-0.198265,0.166364,0.965926,-0.198265,0.166364,0.965926,-0.482963,0.836516,0.258819,-0.482963,0.836516,0.258819,-0.482963,0.836516,0.258819,-0.353556,0.612377,0.707102,-0.353556,0.612377,0.707102,-0.353556,0.612377,0.707102,-0.129409,0.224143,0.965926,-0.129409,0.224143,0.965926,-0.129409,0.224143,0.965926,-0.167731,0.951249,0.258828,-0.167731,0.951249,0.258828,-0.167731,0.951249,0.258828,-0.122788,0.696369,0.707102,-0.122788,0.696369,0.707102,-0.122788,0.696369,0.707102,-0.044943,0.254888,0.965926,0.167731,0.95125,0.258823,0.167731,0.95125,0.258823,0.167731,0.95125,0.258823,0.122787,0.696361,0.70711,0.122787,0.696361,0.70711,0.122787,0.696361,0.70711,0.044944,0.254888,0.965925,0.044944,0.254888,0.965925,0.044944,0.254888,0.965925,0.482965,0.836519,0.258807,0.482965,0.836519,0.258807,0.482965,0.836519,0.258807,0.353557,0.612378,0.707101,0.353557,0.612378,0.707101,0.353557,0.612378,0.707101,0.129407,0.224139,0.965927,0.129407,0.224139,0.965927,0.129407,0.224139,0.965927,0.739941,0.620884,0.258826,0.739941,0.620884,0.258826,0.739941,0.620884,0.258826,0.541675,0.454519,0.707108,0.541675,0.454519,0.707108,0.541675,0.454519,0.707108,0.198269,0.166368,0.965925,0.198269,0.166368,0.965925,0.198269,0.166368,0.965925,0.907671,0.330366,0.258829,0.907671,0.330366,0.258829,0.907671,0.330366,0.258829,0.664462,0.241845,0.707108,0.664462,0.241845,0.707108,0.664462,0.241845,0.707108,0.243212,0.088522,0.965925,0.243212,0.088522,0.965925,0.243212,0.088522,0.965925,0.965927,0,0.258815,0.965927,0,0.258815,0.965927,0,0.258815,0.707106,0,0.707108,0.707106,0,0.707108,0.707106,0,0.707108,0.25882,0,0.965925,0.907671,-0.330365,0.258828,0.907671,-0.330365,0.258828,0.907671,-0.330365,0.258828,0.664468,-0.241846,0.707102,0.664468,-0.241846,0.707102,0.664468,-0.241846,0.707102,0.243212,-0.088522,0.965926,0.243212,-0.088522,0.965926,0.243212,-0.088522,0.965926,0.739944,-0.620886,0.258813,0.739944,-0.620886,0.258813,0.739944,-0.620886,0.258813,0.54167,-0.454515,0.707114,0.54167,-0.454515,0.707114,0.54167,-0.454515,0.707114,0.198267,-0.166366,0.965926,0.198267,-0.166366,0.965926,0.198267,-0.166366,0.965926,0.482964,-0.836519,0.258808,0.482964,-0.836519,0.258808,0.482964,-0.836519,0.258808,0.353552,-0.61237,0.707109,0.353552,-0.61237,0.707109,0.353552,-0.61237,0.707109,0.129409,-0.224143,0.965926,0.129409,-0.224143,0.965926,0.129409,-0.224143,0.965926,0.167731,-0.951249,0.258828,0.167731,-0.951249,0.258828,0.167731,-0.951249,0.258828,0.122789,-0.696369,0.707103,0.122789,-0.696369,0.707103,0.122789,-0.696369,0.707103,0.044944,-0.254888,0.965926,-0.167731,-0.951253,0.258811,-0.167731,-0.951253,0.258811,-0.167731,-0.951253,0.258811,-0.122787,-0.696361,0.70711,-0.122787,-0.696361,0.70711,-0.122787,-0.696361,0.70711,-0.044944,-0.254888,0.965926,-0.482965,-0.83652,0.258804,-0.482965,-0.83652,0.258804,-0.482965,-0.83652,0.258804,-0.353549,-0.612365,0.707116,-0.353549,-0.612365,0.707116,-0.353549,-0.612365,0.707116,-0.12941,-0.224145,0.965926,-0.73994,-0.620884,0.258826,-0.541676,-0.454521,0.707105,-0.541676,-0.454521,0.707105,-0.541676,-0.454521,0.707105,-0.198267,-0.166366,0.965926,-0.198267,-0.166366,0.965926,-0.198267,-0.166366,0.965926,-0.907672,-0.330366,-0.258826,-0.907672,-0.330366,-0.258826,-0.907672,-0.330366,-0.258826,-0.664463,-0.241845,-0.707107,-0.664463,-0.241845,-0.707107,-0.664463,-0.241845,-0.707107,-0.24321,-0.088521,-0.965926,-0.24321,-0.088521,-0.965926,-0.24321,-0.088521,-0.965926,-0.965926,-1e-06,-0.258817,-0.965926,-1e-06,-0.258817,-0.965926,-1e-06,-0.258817,-0.707106,-0,-0.707107,-0.258819,-0,-0.965926,-0.907674,0.330366,-0.258816,-0.907674,0.330366,-0.258816,-0.907674,0.330366,-0.258816,-0.664464,0.241845,-0.707106,-0.664464,0.241845,-0.707106,-0.664464,0.241845,-0.707106,-0.243209,0.088521,-0.965926,-0.243209,0.088521,-0.965926,-0.243209,0.088521,-0.965926,-0.73994,0.620883,-0.25883,-0.73994,0.620883,-0.25883,-0.73994,0.620883,-0.25883,-0.54168,0.454523,-0.707101,-0.54168,0.454523,-0.707101,-0.54168,0.454523,-0.707101,-0.198267,0.166366,-0.965926,-0.198267,0.166366,-0.965926,-0.198267,0.166366,-0.965926,-0.482964,0.836518,-0.258812,-0.482964,0.836518,-0.258812,-0.482964,0.836518,-0.258812,-0.353552,0.612369,-0.70711,-0.353552,0.612369,-0.70711,-0.353552,0.612369,-0.70711,-0.129408,0.224142,-0.965926,-0.129408,0.224142,-0.965926,-0.129408,0.224142,-0.965926,-0.167731,0.951252,-0.258818,-0.167731,0.951252,-0.258818,-0.167731,0.951252,-0.258818,-0.122788,0.696365,-0.707106,-0.122788,0.696365,-0.707106,-0.122788,0.696365,-0.707106,-0.044943,0.254886,-0.965926,-0.044943,0.254886,-0.965926,-0.044943,0.254886,-0.965926,0.167732,0.951253,-0.25881,0.167732,0.951253,-0.25881,0.167732,0.951253,-0.25881,0.122788,0.696364,-0.707107,0.122788,0.696364,-0.707107,0.122788,0.696364,-0.707107,0.044944,0.254887,-0.965926,0.044944,0.254887,-0.965926,0.044944,0.254887,-0.965926,0.482961,0.836513,-0.258831,0.482961,0.836513,-0.258831,0.482961,0.836513,-0.258831,0.353555,0.612374,-0.707104,0.353555,0.612374,-0.707104,0.353555,0.612374,-0.707104,0.12941,0.224144,-0.965926,0.12941,0.224144,-0.965926,0.12941,0.224144,-0.965926,0.739942,0.620885,-0.258821,0.739942,0.620885,-0.258821,0.739942,0.620885,-0.258821,0.541676,0.45452,-0.707106,0.541676,0.45452,-0.707106,0.541676,0.45452,-0.707106,0.198266,0.166365,-0.965926,0.198266,0.166365,-0.965926,0.198266,0.166365,-0.965926,0.907674,0.330367,-0.258816,0.907674,0.330367,-0.258816,0.907674,0.330367,-0.258816,0.664461,0.241844,-0.707108,0.664461,0.241844,-0.707108,0.664461,0.241844,-0.707108,0.243209,0.088521,-0.965926,0.965926,1e-06,-0.258817,0.707106,0,-0.707107,0.258819,0,-0.965926,0.258819,0,-0.965926,0.258819,0,-0.965926,0.907672,-0.330365,-0.258827,0.907672,-0.330365,-0.258827,0.907672,-0.330365,-0.258827,0.664468,-0.241846,-0.707102,0.664468,-0.241846,-0.707102,0.664468,-0.241846,-0.707102,0.243208,-0.08852,-0.965926,0.243208,-0.08852,-0.965926,0.243208,-0.08852,-0.965926,0.73994,-0.620883,-0.25883,0.73994,-0.620883,-0.25883,0.73994,-0.620883,-0.25883,0.54168,-0.454523,-0.707101,0.54168,-0.454523,-0.707101,0.54168,-0.454523,-0.707101,0.198267,-0.166365,-0.965926,0.198267,-0.166365,-0.965926,0.198267,-0.166365,-0.965926,0.482965,-0.836518,-0.25881,0.482965,-0.836518,-0.25881,0.482965,-0.836518,-0.25881,0.353554,-0.612372,-0.707106,0.353554,-0.612372,-0.707106,0.353554,-0.612372,-0.707106,0.129408,-0.224142,-0.965926,0.129408,-0.224142,-0.965926,0.129408,-0.224142,-0.965926,0.167732,-0.951252,-0.258818,0.167732,-0.951252,-0.258818,0.167732,-0.951252,-0.258818,0.122788,-0.696366,-0.707105,0.122788,-0.696366,-0.707105,0.122788,-0.696366,-0.707105,0.044944,-0.254888,-0.965926,0.044944,-0.254888,-0.965926,0.044944,-0.254888,-0.965926,-0.167731,-0.951251,-0.25882,-0.167731,-0.951251,-0.25882,-0.167731,-0.951251,-0.25882,-0.122788,-0.696365,-0.707106,-0.122788,-0.696365,-0.707106,-0.122788,-0.696365,-0.707106,-0.044943,-0.254887,-0.965926,-0.044943,-0.254887,-0.965926,-0.044943,-0.254887,-0.965926,-0.482961,-0.836514,-0.25883,-0.482961,-0.836514,-0.25883,-0.482961,-0.836514,-0.25883,-0.353556,-0.612377,-0.707102,-0.353556,-0.612377,-0.707102,-0.353556,-0.612377,-0.707102,-0.12941,-0.224145,-0.965925,-0.12941,-0.224145,-0.965925,-0.12941,-0.224145,-0.965925,-0.739941,-0.620884,-0.258825,-0.739941,-0.620884,-0.258825,-0.739941,-0.620884,-0.258825,-0.541676,-0.454521,-0.707106,-0.541676,-0.454521,-0.707106,-0.541676,-0.454521,-0.707106,-0.198267,-0.166366,-0.965926,-0.198267,-0.166366,-0.965926,-0.198267,-0.166366,-0.965926,-1,-0,0,-1,-0,0,-1,-0,-0,0,0,0,-0.586069,-0.810261,-0,-0.297134,0.954836,0,-0.453888,-0.891059,-0,-0.317928,-0.948115,-0,-0.082546,0.996587,0,-0.10556,-0.994413,-0,-0.061654,0.998098,0,0.189497,-0.981881,0,-0.303945,0.952689,0,0,0,1,0,0,1,0,0,1,-0,-0,1,0,-0,1,0,-0,1,-0,-0,1,-0,-0,1,-0,-0,1,0,0,1,0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,-0,1,-0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,-0,0,1,0,0,1,0,0,1,0,-0,1,0,-0,1,0,-0,1,0,-0,1,0,-0,1,0.310469,-0.950583,0,-0.39898,0.916959,0,0.434419,-0.900711,0,-0.503534,0.863976,0,0.530485,-0.847695,0,-0.507184,0.861838,0,0.263968,-0.964531,0,-0.083608,-0.996499,-0,0.905821,0.42366,0,-0.548497,-0.836152,-0,-0.749817,-0.661646,-0,-0.87845,-0.477835,-0,-0.933111,-0.359589,-0,-0.971901,-0.235391,-0,0.955685,0.294392,0,-0.903119,-0.429389,-0,-0.755136,-0.655568,-0,-0.61393,-0.78936,-0,-0.490653,-0.871355,-0,0.97736,0.211582,0,-0.581499,-0.813547,-0,0.98353,0.180742,0,0.987192,-0.159535,0,-0.54999,0.835171,0,0.92873,-0.370757,0,0.685661,-0.727921,0,0.259319,-0.965792,0,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,0,0,1,0,0,1,-0,0,1,0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,0,1,-0,-0,1,-0.174577,-0.984644,-0,-0.586068,-0.810262,-0,-0.210473,0.319607,0.923879,-0.508125,0.771596,0.382685,-0.508125,0.771596,0.382685,-0.508125,0.771596,0.382685,-0.113709,0.365403,0.923878,-0.113709,0.365403,0.923878,-0.113709,0.365403,0.923878,-0.274513,0.88215,0.382694,-0.274513,0.88215,0.382694,-0.274513,0.88215,0.382694,-0.031589,0.381376,0.92388,-0.031589,0.381376,0.92388,-0.031589,0.381376,0.92388,-0.076264,0.920727,0.382681,-0.076264,0.920727,0.382681,-0.076264,0.920727,0.382681,-0.023594,0.381955,0.92388,-0.023594,0.381955,0.92388,-0.023594,0.381955,0.92388,-0.05696,0.922121,0.382686,-0.05696,0.922121,0.382686,-0.05696,0.922121,0.382686,-0.116315,0.364577,0.92388,-0.116315,0.364577,0.92388,-0.116315,0.364577,0.92388,-0.280809,0.880171,0.382681,-0.280809,0.880171,0.382681,-0.280809,0.880171,0.382681,-0.152683,0.350905,0.92388,-0.152683,0.350905,0.92388,-0.152683,0.350905,0.92388,-0.368609,0.84716,0.382685,-0.368609,0.84716,0.382685,-0.368609,0.84716,0.382685,-0.192694,0.330629,0.92388,-0.192694,0.330629,0.92388,-0.192694,0.330629,0.92388,-0.465204,0.79821,0.382683,-0.465204,0.79821,0.382683,-0.465204,0.79821,0.382683,0.346644,0.162129,0.923879,0.346644,0.162129,0.923879,0.346644,0.162129,0.923879,0.836868,0.391411,0.382687,0.836868,0.391411,0.382687,0.836868,0.391411,0.382687,0.365726,0.112659,0.923879,0.365726,0.112659,0.923879,0.365726,0.112659,0.923879,0.882935,0.271981,0.382691,0.882935,0.271981,0.382691,0.882935,0.271981,0.382691,0.374,0.080963,0.923888,0.374,0.080963,0.923888,0.374,0.080963,0.923888,0.902952,0.195472,0.382712,0.902952,0.195472,0.382712,0.902952,0.195472,0.382712,0.376377,0.069166,0.923881,0.376377,0.069166,0.923881,0.376377,0.069166,0.923881,0.908665,0.166984,0.38268,0.908665,0.166984,0.38268,0.908665,0.166984,0.38268,0.377782,-0.061051,0.92388,0.377782,-0.061051,0.92388,0.377782,-0.061051,0.92388,0.912045,-0.147392,0.382686,0.912045,-0.147392,0.382686,0.912045,-0.147392,0.382686,0.355409,-0.141882,0.92388,0.858036,-0.342536,0.382679,0.858036,-0.342536,0.382679,0.858036,-0.342536,0.382679,0.262393,-0.278565,0.923879,0.262393,-0.278565,0.923879,0.262393,-0.278565,0.923879,0.633469,-0.672513,0.382678,0.633469,-0.672513,0.382678,0.633469,-0.672513,0.382678,0.099237,-0.369593,0.923879,0.239578,-0.892274,0.382686,0.239578,-0.892274,0.382686,0.239578,-0.892274,0.382686,-0.066807,-0.376807,0.92388,-0.066807,-0.376807,0.92388,-0.066807,-0.376807,0.92388,-0.161288,-0.909695,0.382676,-0.161288,-0.909695,0.382676,-0.161288,-0.909695,0.382676,-0.224279,-0.310074,0.92388,-0.541457,-0.748584,0.382683,-0.22428,-0.310075,0.923879,-0.22428,-0.310075,0.923879,-0.22428,-0.310075,0.923879,-0.541456,-0.748581,0.382691,-0.541456,-0.748581,0.382691,-0.541456,-0.748581,0.382691,-0.173695,-0.340994,0.92388,-0.173695,-0.340994,0.92388,-0.173695,-0.340994,0.92388,-0.419338,-0.823231,0.382681,-0.419338,-0.823231,0.382681,-0.419338,-0.823231,0.382681,-0.121666,-0.362828,0.923879,-0.293728,-0.875944,0.382683,-0.293728,-0.875944,0.382683,-0.293728,-0.875944,0.382683,-0.040396,-0.380543,0.92388,-0.040396,-0.380543,0.92388,-0.040396,-0.380543,0.92388,-0.097525,-0.918717,0.382685,-0.097525,-0.918717,0.382685,-0.097525,-0.918717,0.382685,0.072517,-0.37575,0.923879,0.072517,-0.37575,0.923879,0.072517,-0.37575,0.923879,0.175072,-0.907139,0.382687,0.175072,-0.907139,0.382687,0.175072,-0.907139,0.382687,0.118811,-0.363772,0.92388,0.118811,-0.363772,0.92388,0.118811,-0.363772,0.92388,0.286836,-0.878224,0.382684,0.286836,-0.878224,0.382684,0.286836,-0.878224,0.382684,0.166246,-0.344689,0.923879,0.166246,-0.344689,0.923879,0.166246,-0.344689,0.923879,0.40135,-0.832146,0.38269,0.40135,-0.832146,0.38269,0.40135,-0.832146,0.38269,0.203008,-0.324399,0.92388,0.203008,-0.324399,0.92388,0.203008,-0.324399,0.92388,0.490104,-0.783168,0.382684,0.490104,-0.783168,0.382684,0.490104,-0.783168,0.382684,0.101016,-0.36911,0.92388,0.101016,-0.36911,0.92388,0.101016,-0.36911,0.92388,0.243875,-0.891111,0.382683,-0.031996,-0.381345,0.923879,-0.031996,-0.381345,0.923879,-0.031996,-0.381345,0.923879,-0.077244,-0.920644,0.382686,-0.077244,-0.920644,0.382686,-0.077244,-0.920644,0.382686,-0.2099,-0.31998,0.92388,-0.2099,-0.31998,0.92388,-0.2099,-0.31998,0.92388,-0.506745,-0.772504,0.382684,-0.286944,-0.253203,0.923879,-0.286944,-0.253203,0.923879,-0.286944,-0.253203,0.923879,-0.692739,-0.611278,0.38269,-0.692739,-0.611278,0.38269,-0.692739,-0.611278,0.38269,-0.336169,-0.18286,0.923879,-0.336169,-0.18286,0.923879,-0.336169,-0.18286,0.923879,-0.811581,-0.441462,0.382685,-0.811581,-0.441462,0.382685,-0.811581,-0.441462,0.382685,-0.357083,-0.137608,0.923881,-0.357083,-0.137608,0.923881,-0.357083,-0.137608,0.923881,-0.862083,-0.332218,0.382679,-0.862083,-0.332218,0.382679,-0.862083,-0.332218,0.382679,-0.371932,-0.090081,0.923879,-0.371932,-0.090081,0.923879,-0.371932,-0.090081,0.923879,-0.897918,-0.217472,0.382686,-0.897918,-0.217472,0.382686,-0.897918,-0.217472,0.382686,-0.345611,-0.164321,0.923878,-0.345611,-0.164321,0.923878,-0.345611,-0.164321,0.923878,-0.834373,-0.396704,0.382685,-0.288976,-0.250873,0.923881,-0.288976,-0.250873,0.923881,-0.288976,-0.250873,0.923881,-0.697656,-0.605666,0.38268,-0.697656,-0.605666,0.38268,-0.697656,-0.605666,0.38268,-0.234941,-0.302075,0.92388,-0.234941,-0.302075,0.92388,-0.234941,-0.302075,0.92388,-0.567197,-0.729273,0.382686,-0.567197,-0.729273,0.382686,-0.567197,-0.729273,0.382686,-0.187766,-0.333455,0.923878,-0.187766,-0.333455,0.923878,-0.187766,-0.333455,0.923878,-0.453304,-0.805026,0.382686,-0.453304,-0.805026,0.382686,-0.453304,-0.805026,0.382686,-0.222528,-0.311329,0.923881,-0.222528,-0.311329,0.923881,-0.222528,-0.311329,0.923881,-0.537235,-0.751619,0.382684,-0.537235,-0.751619,0.382684,-0.537235,-0.751619,0.382684,-0.263263,-0.27774,0.92388,-0.263263,-0.27774,0.92388,-0.263263,-0.27774,0.92388,-0.635568,-0.670522,0.382692,-0.635568,-0.670522,0.382692,-0.635568,-0.670522,0.382692,-0.194091,0.329812,0.923879,-0.468575,0.796234,0.382687,-0.468575,0.796234,0.382687,-0.468575,0.796234,0.382687,-0.687937,-0.725771,-0,0.287412,-0.599146,0.747274,0.287412,-0.599146,0.747274,0.287412,-0.599146,0.747274,-0.148946,-0.691242,0.707107,-0.624903,-0.330901,0.707107,-0.624903,-0.330901,0.707107,-0.624903,-0.330901,0.707107,-0.787612,0.15327,0.596804,-0.787612,0.15327,0.596804,-0.787612,0.15327,0.596804,-0.292886,0.584139,0.756967,-0.292886,0.584139,0.756967,-0.292886,0.584139,0.756967,0.179808,0.683864,0.707106,0.179808,0.683864,0.707106,0.179808,0.683864,0.707106,0.607877,0.361228,0.707107,0.667776,-0.387044,0.635823,0.667776,-0.387044,0.635823,0.667776,-0.387044,0.635823,-0.206701,-0.786148,0.582448,-0.206701,-0.786148,0.582448,-0.206701,-0.786148,0.582448,0.766948,-0.14762,0.624499,0.175043,0.812357,0.55627,-0.698158,-0.414877,0.583483,-0.698158,-0.414877,0.583483,-0.698158,-0.414877,0.583483,0.357947,-0.711122,0.605127,0.704509,0.373054,0.603737,0.704509,0.373054,0.603737,0.704509,0.373054,0.603737,0.360123,-0.747596,-0.558043,0.360123,-0.747596,-0.558043,0.360123,-0.747596,-0.558043,-0.702348,0.405738,0.58488,-0.702348,0.405738,0.58488,-0.702348,0.405738,0.58488,-0,0,1,-0,0,1,-0,0,1,0,0,1,0,0,1,0,0,1,0.941271,-0.337653,0,-0.954711,0.297534,0,0,0,1,0,0,1,0,0,1,-0,0,1,-0,0,1,0,0,1,-0,0,1,-0,0,1,0,-0,1,0,-0,1,0,-0,1,0,0,1,0,-0,1,-0.824561,0.565773,0,0.999934,0.011472,0,-0.701034,0.713128,0,0.989958,0.141365,0,-0.365354,0.113862,0.923879,-0.882038,0.274886,0.382684,-0.882038,0.274886,0.382684,-0.882038,0.274886,0.382684,0.378841,0.054098,0.923879,0.914601,0.130604,0.382685,0.914601,0.130604,0.382685,0.914601,0.130604,0.382685,-0.315545,0.216511,0.92388,-0.315545,0.216511,0.92388,-0.315545,0.216511,0.92388,-0.761795,0.522706,0.382684,-0.761795,0.522706,0.382684,-0.761795,0.522706,0.382684,0.382658,0.00439,0.92388,0.382658,0.00439,0.92388,0.382658,0.00439,0.92388,0.923819,0.010599,0.382684,0.923819,0.010599,0.382684,0.923819,0.010599,0.382684,-0.268275,0.272904,0.923879,-0.268275,0.272904,0.923879,-0.268275,0.272904,0.923879,-0.647671,0.658845,0.382682,-0.647671,0.658845,0.382682,-0.647671,0.658845,0.382682,0.360209,-0.129214,0.92388,0.360209,-0.129214,0.92388,0.360209,-0.129214,0.92388,0.86962,-0.311951,0.382684,0.86962,-0.311951,0.382684,0.86962,-0.311951,0.382684,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,-0,-0,1,0,0,1,0,0,1,0,-0,1,0,0,1};
-const GLfloat coin_silver_colors[] = {0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.2,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.745,0.675,0.239,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.765,0.635,0.188,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886,0.706,0.761,0.886};
-const GLushort coin_silver_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,53,69,70,60,71,72,63,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,64,124,125,126,61,51,127,128,129,130,123,131,126,132,74,58,133,72,127,134,70,135,129,68,136,131,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,66,59,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,524,528,529,527,530,531,529,532,525,532,533,526,523,534,528,526,535,530,528,536,532,537,538,523,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1025,1028,1029,1029,1030,1031,1028,1032,1030,1033,1034,1026,1033,1035,1028,2,1036,0,1036,1037,0,1037,1038,0,5,1039,3,1040,1041,1042,1041,1043,1042,8,1044,6,1044,1045,6,1045,1046,6,11,1047,9,1047,1048,9,1048,1049,9,14,1050,12,1050,1051,12,1051,1052,12,17,1053,15,1053,1054,15,1054,1055,15,20,1056,18,1056,1057,18,1057,1058,18,23,1059,21,1059,1060,21,1060,1061,21,26,1062,24,1062,1063,24,1063,1064,24,29,1065,27,1065,1066,27,1066,1067,27,32,1068,30,1068,1069,30,1069,1070,30,35,1071,33,1071,1072,33,1072,1073,33,38,1074,36,1074,1075,36,1075,1076,36,41,1077,39,1077,1078,39,1078,1079,39,44,1080,42,1080,1081,42,1081,1082,42,47,1083,45,1083,1084,45,1084,1085,45,48,1086,49,51,128,52,54,1087,55,57,133,58,60,125,61,63,124,64,66,356,67,53,52,69,60,62,71,63,65,73,75,1088,76,78,1089,79,81,1090,82,84,1091,85,87,1092,88,90,1093,91,93,1094,94,96,1095,97,99,1096,100,102,1097,103,105,1098,106,108,1099,109,111,1100,112,114,1101,115,119,1102,117,1102,1103,117,1103,1104,117,120,1105,121,123,130,64,125,132,126,51,134,127,129,135,130,131,136,126,74,73,58,72,71,127,70,69,135,68,67,136,1106,1107,1108,140,1109,141,1110,1111,1112,1113,1114,1115,1116,1117,1118,1119,1120,1121,1122,1123,1124,1125,1126,1127,1128,1129,1130,1131,1132,1133,167,1134,168,1135,1136,1137,1138,1139,1140,176,1141,177,179,1142,180,1143,1144,1145,1146,1147,1148,1149,1150,1151,191,1152,192,1153,1154,1155,197,1156,198,200,1157,201,1158,1159,1160,1161,1162,1163,1164,1165,1166,1167,1168,1169,1170,1171,1172,1173,1174,1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,1196,1197,1198,1199,245,1200,246,1201,1202,1203,1204,1205,1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,1227,1228,1229,1230,1231,1232,1233,1234,1235,1236,1237,1238,1239,1240,1241,1242,290,1243,291,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,1257,1258,1259,1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,1276,326,1277,327,1278,1279,1280,1281,1282,1283,335,1284,336,1285,1286,1287,1288,1289,1290,344,1291,345,347,1292,348,1293,1294,1295,1296,1297,1298,66,57,59,1299,1300,1301,1302,1303,1304,1305,1306,1307,1308,1309,1310,369,1311,370,372,1312,373,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,1323,1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,1335,1336,1337,1338,1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,1350,1351,1352,1353,1354,1355,1356,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,1371,1372,1373,1374,1375,1376,1377,1378,1379,1380,1381,444,1382,445,447,1383,448,450,1384,451,1385,1386,1387,1388,1389,1390,1391,1392,1393,1394,1395,1396,1397,1398,1399,1400,1401,1402,1403,1404,1405,1406,1407,1408,1409,1410,1411,1412,1413,1414,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1425,1426,1427,1428,1429,1430,1431,1432,1433,1434,1435,1436,1437,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,521,1451,519,1451,1452,519,1452,1453,519,522,537,523,525,532,526,524,523,528,527,526,530,529,528,532,532,536,533,523,538,534,526,533,535,528,534,536,537,1454,538,539,1455,540,542,1456,543,545,1457,546,548,1458,549,551,1459,552,554,1460,555,557,1461,558,560,1462,561,563,1463,564,1464,1465,1466,1464,1466,1467,1466,1468,1469,1467,1466,1470,1470,1466,1469,1468,1471,1472,1469,1468,1472,1473,651,1474,651,650,1475,1475,650,1476,1471,1473,1477,1472,1471,1478,651,1475,1474,1478,1471,1479,1478,1479,1480,1473,1474,1481,1482,1483,1484,1483,1480,1485,1484,1483,1485,1484,1486,1482,1487,1485,1480,1477,1479,1471,1479,1487,1480,1473,1481,1488,1473,1488,1477,1481,1489,1488,1489,566,568,1488,1489,568,566,1490,567,1490,1491,567,1491,1492,1493,1492,1494,1495,1493,1492,1495,1493,567,1491,569,1496,570,572,1497,573,575,1498,576,578,1499,579,581,1500,582,584,1501,585,587,1502,588,590,1503,591,593,1504,594,596,1505,597,599,1506,600,602,1507,603,605,1508,606,608,1509,609,611,1510,612,614,1511,615,617,1512,618,620,1513,621,623,1514,624,626,1515,627,629,1516,630,632,1517,633,635,1518,636,638,1519,639,641,1520,642,644,1521,645,647,1522,648,1523,1524,1525,1524,1526,1525,1526,1527,1465,1527,1528,1465,1528,1529,1465,1529,1530,1466,1466,1531,1532,1531,1533,1534,1531,1466,1530,1532,1531,1534,1535,1526,1465,1535,1525,1526,1466,1465,1529,1532,1534,1536,1536,1537,1532,1532,1537,1538,1537,1539,1538,1539,1540,1538,1540,1541,652,1541,650,652,1540,652,1538,653,1542,654,656,1543,657,659,1544,660,1545,1546,1547,1548,1549,1550,1551,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,1576,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,731,1614,732,1615,1616,1617,1618,1619,1620,1621,1622,1623,743,1624,744,1625,1626,1627,1628,1629,1630,1631,1632,1633,755,1634,756,1635,764,766,1636,1637,1638,1639,1640,1641,1642,1643,1644,1645,1646,1647,773,1648,774,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,812,1685,813,1686,1687,1688,1689,1690,1691,1692,1693,1694,824,1695,825,1696,1697,1698,1699,1700,1701,1702,1703,1704,1705,1706,1707,1708,1709,1710,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,1721,1722,854,1723,855,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1745,1746,1747,1748,1749,1750,1751,1752,1753,887,1754,888,1755,1756,1757,893,1758,894,1759,1760,1761,899,1762,900,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,914,1775,915,1776,1777,1778,1779,1780,1781,923,1782,924,926,1783,927,1784,1785,1786,932,1787,933,1788,1789,1790,1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,968,1803,969,971,1804,972,1805,1806,1807,1808,1809,974,1805,1807,1808,1810,1805,1808,1810,1808,1811,1808,974,976,1811,1808,1812,1812,1808,976,1813,1814,1815,1813,1815,974,1815,1816,974,974,1816,1817,974,1817,975,977,1818,978,980,1819,981,983,1820,984,986,1821,987,989,1822,990,1823,1824,1825,995,1826,996,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1851,1852,1853,1025,1033,1026,1025,1033,1028,1029,1028,1030,1028,1035,1032,1033,1854,1034,1033,1854,1035,1855,1856,1857,1858,1859,1860,1860,1861,1855,1855,1862,1863,1863,1864,1865,1865,1866,1867,1867,1868,1865,1868,1856,1865,1856,1869,1870,1870,1871,1856,1871,1857,1856,1857,1872,1858,1858,1860,1855,1855,1863,1865,1857,1858,1855,1855,1865,1856};
-const GLsizeiptr coin_silver_numind = 2481;
-const GLsizeiptr coin_silver_numvert = 1873;
-
-#endif
@@ -22,6 +22,51 @@
 "Change Game Speed Settings (1-32)\n" \
 "    --push-speed {VALUE}\n" \
 "    --ps {VALUE}\n\n" \
+"Change how many coins the pitch opens with (default 127)\n" \
+"    --coins {VALUE}\n" \
+"    -cn {VALUE}\n\n" \
+"Change the pitch coin radius (0.02-0.5, default 0.3)\n" \
+"    --coin-radius {VALUE}\n" \
+"    -cr {VALUE}\n\n" \
+"Preload opening layouts from a file\n" \
+"    --layout-bank {FILE}\n" \
+"    -lb {FILE}\n\n" \
+"Generate a file of opening layouts\n" \
+"    --make-layouts {FILE} {COUNT}\n" \
+"    -ml {FILE} {COUNT}\n\n" \
+"Load the pitch outline from a file of \"x y kind\" lines\n" \
+"    --pitch {FILE}\n" \
+"    -pt {FILE}\n\n" \
+"Solve collisions in strips on this many threads (0 = off, default 0)\n" \
+"    --threads {VALUE}\n" \
+"    -th {VALUE}\n\n" \
+"Fuzz the optimised physics against the reference solver, this checks\n" \
+"which coin pairs are found, not how a pair is pushed apart\n" \
+"    --fuzz {SECONDS}\n" \
+"    -fz {SECONDS}\n\n" \
+"Replay a board written by --fuzz\n" \
+"    --fuzz-case {FILE}\n" \
+"    -fc {FILE}\n\n" \
+"Run the simulation at this many ticks a second (10-1000, default 60)\n" \
+"    --tick-rate {VALUE}\n" \
+"    -tr {VALUE}\n\n" \
+"Play this many games headless on --threads threads and report\n" \
+"    --simulate {GAMES}\n" \
+"    -sm {GAMES}\n\n" \
+"Seed the games --simulate plays, the same seed plays the same games\n" \
+"on any number of threads (default the clock)\n" \
+"    --seed {VALUE}\n" \
+"    -sd {VALUE}\n\n" \
+"Write where coins dwelt and left the pitch while simulating,\n" \
+"a .csv name gets a CSV grid, anything else a binary one\n" \
+"    --heatmap {FILE}\n" \
+"    -hm {FILE}\n\n" \
+"Write a CSV line for every drop and game while simulating\n" \
+"    --records {FILE}\n" \
+"    -rc {FILE}\n\n" \
+"Draw Tux coarser on slow machines (0-2, default 0)\n" \
+"    --detail {VALUE}\n" \
+"    -dl {VALUE}\n\n" \
 "\n" \
 "  -= CONTROLS =-\n\n" \
 "Left Click = Release coin\n" \
@@ -54,6 +54,7 @@ typedef struct
     GLuint cid;	// Colour Array Buffer ID
     GLuint nid;	// Normal Array Buffer ID
     GLuint tid;	// TexCoord Array Buffer ID
+    GLuint vao;	// Vertex Array Object ID
 } ESModel;
 
 //*************************************
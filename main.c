@@ -23,12 +23,18 @@
     can now be set via the second argv.
 */
 
+#define _GNU_SOURCE // SCHED_IDLE
 #include <SDL2/SDL_mouse.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stddef.h>
 
 #ifdef BUILD_GLFW
     #include "inc/gl.h"
@@ -50,12 +56,19 @@
     #define SEIR_RAND
 #endif
 
+// uncomment for integer coin physics that plays out exactly the same on
+// every compiler, optimisation level and SSE/NOSSE build
+//#define FIXED_POINT
+
+// uncomment to count what the collision solver does every substep, costs
+// nothing when it is left commented out
+//#define PHYS_STATS
+
 #include "esAux2.h"
 #include "res.h"
 
 #include "assets/scene.h"
 #include "assets/coin.h"
-#include "assets/coin_silver.h"
 #include "assets/tux.h"
 #include "assets/evil.h"
 #include "assets/king.h"
@@ -125,7 +138,6 @@ ESModel mdlPlane;
 ESModel mdlGameover;
 ESModel mdlScene;
 ESModel mdlCoin;
-ESModel mdlCoinSilver;
 ESModel mdlTux;
 ESModel mdlEvil;
 ESModel mdlKing;
@@ -137,31 +149,222 @@ ESModel mdlSA;
 ESModel mdlGA;
 
 // game vars
-f32 gold_stack = 64.f;  // line 740+ defining these as float32 eliminates the need to cast in mTranslate()
-f32 silver_stack = 64.f;// function due to the use of a float32 also in the for(f32 i;) loop.
-uint active_coin = 0;
-uint inmotion = 0;
 f32 gameover = 0.f;
-uint isnewcoin = 0;
 f32 PUSH_SPEED = 1.6f;
 
-typedef struct
-{
-    f32 x, y, r;
-    signed char color;
-} coin; // 4+4+4+1 = 13 bytes, 3 bytes padding to 16 byte cache line
-#define MAX_COINS 130
-coin coins[MAX_COINS] = {0};
+// Coin positions are cpos, in the FIXED_POINT build that is Q3.12 so the
+// pitch (+/- 5 units) fits an int16 with 1/4096 unit resolution and all of
+// the collision math is integer. F2P() converts world units to a cpos and
+// P2F() back, both are no-ops in the float build. Products such as squared
+// distances are kept in a cacc which is int32 in the FIXED_POINT build.
+// PWALL() is the x of a pitch edge at y that is x0 at y0 and slopes by s.
+#ifdef FIXED_POINT
+    typedef sint cpos;
+    typedef int cacc;
+    #define F2P(f) ((cpos)((f)*4096.f + ((f) < 0.f ? -0.5f : 0.5f)))
+    #define P2F(v) ((f32)(v)*0.000244140625f)
+    #define PWALL(x0,s,y0,y) ((x0) + (abs((cacc)(y) - (y0)) * (s)) / 4096)
+    typedef struct
+    {
+        cpos x, y, r;
+        signed char color;
+        char pad;
+    } coin; // 2+2+2+1+1 = 8 bytes
+#else
+    typedef f32 cpos;
+    typedef f32 cacc;
+    #define F2P(f) (f)
+    #define P2F(v) (v)
+    #define PWALL(x0,s,y0,y) ((x0) + (s)*fabsf((y) - (y0)))
+    typedef struct
+    {
+        cpos x, y, r;
+        signed char color;
+    } coin; // 4+4+4+1 = 13 bytes, 3 bytes padding to 16 byte cache line
+#endif
 
-// Bit flag based method for storing trophie states, 
+// Bit flag based method for storing trophie states,
 // 0b0000_0000 where the last bit denotes 1, second last denotes 2 etc like so:
 // 0b0000_0001 = trophie 1
 // 0b0000_0101 = trophie 1 and 3
-char trophies_bits = 0; 
-#define trophies_set(x) trophies_bits |= (0b1 << x)
-#define trophies_clear() trophies_bits = 0
-#define trophies_get(x) (trophies_bits >> x) & 0b1
-#define trophies_all() trophies_bits
+#define trophies_set(tb,x) (tb)->trophies_bits |= (0b1 << (x))
+#define trophies_clear(tb) (tb)->trophies_bits = 0
+#define trophies_get(tb,x) (((tb)->trophies_bits >> (x)) & 0b1)
+#define trophies_all(tb) (tb)->trophies_bits
+
+// Everything one coin pusher machine needs to play, the coins live in a
+// pool that only grows (doubling) so there is never a malloc per coin and
+// the live coins are kept packed below num_coins so every loop over the
+// pitch is bounded by the live count rather than the capacity.
+// Slots 0 to 2 always belong to the three trophies.
+#define TROPHY_R 0.36f
+
+// The collision pass only notes which coins left the pitch and how,
+// payouts and trophy rules are applied from the list once it is done.
+#define SCORE_LOST   0 // fell off a side
+#define SCORE_SILVER 1 // into the silver goal
+#define SCORE_GOLD   2 // into the gold goal
+#define SCORE_SPILL  3 // over the back beside the gold goal, pays 1 silver
+typedef struct
+{
+    unsigned int coin;  // slot it left from, trophies are 0 to 2
+    signed char color;  // its colour before it left
+    unsigned char kind; // SCORE_*
+} scoreev;
+
+// Where coins spend their time and where they leave, over a fixed grid
+// covering the broadphase bounds. Dwell counts one per live coin per step
+// and each SCORE_* kind has its own exit grid. A table only tallies into
+// the heatmap it is given, so tables on different threads each keep their
+// own and they are summed at the end.
+#define HEAT_W 72       // 0.1 unit cells
+#define HEAT_H 96
+#define HEAT_RCELL 10.f
+typedef struct
+{
+    unsigned int dwell[HEAT_W*HEAT_H];
+    unsigned int exits[4][HEAT_W*HEAT_H];
+    unsigned long long steps;
+} heatmap;
+
+// Solver counters, each thread counts into its own phys_stats while it
+// solves and stepCollisions() gathers them into the table once a substep
+// is done. Penetration is binned by powers of four of the pair's summed
+// radii, bin k holds depths from 1/4^(k+1) of it up, the last bin the rest.
+#ifdef PHYS_STATS
+    #define STATS_DEPTHS 8
+    typedef struct
+    {
+        unsigned long long tests;     // pairs collidePair() was asked about
+        unsigned long long skipped;   // of those, dropped by the ym > 0 shortcut
+        unsigned long long resolved;  // overlapping pairs pushed apart
+        unsigned long long depth[STATS_DEPTHS];
+        unsigned long long clamps;    // coins clamped back inside a wall
+        unsigned long long exits[4];  // coins that left the pitch, by SCORE_*
+        unsigned long long substeps;
+    } physstats;
+    _Thread_local physstats phys_stats;
+    #define PSTAT(x) x
+#else
+    #define PSTAT(x)
+#endif
+
+#ifdef PHYS_STATS
+void statsAdd(physstats* s, const physstats* o)
+{
+    s->tests += o->tests;
+    s->skipped += o->skipped;
+    s->resolved += o->resolved;
+    for(int i=0; i < STATS_DEPTHS; i++)
+        s->depth[i] += o->depth[i];
+    s->clamps += o->clamps;
+    for(int i=0; i < 4; i++)
+        s->exits[i] += o->exits[i];
+    s->substeps += o->substeps;
+}
+
+// totals over frames stepTable() calls as means per substep and per frame
+void statsPrint(const physstats* s, const unsigned long long frames)
+{
+    const double ps = s->substeps > 0 ? 1.0 / s->substeps : 0.0;
+    const double pf = frames > 0 ? 1.0 / frames : 0.0;
+    const unsigned long long ex = s->exits[SCORE_SILVER] + s->exits[SCORE_GOLD] + s->exits[SCORE_SPILL];
+    printf("%-23s %12s %12s\n", "solver", "a substep", "a frame");
+    printf("%-23s %12.2f %12.2f\n", "pair tests", s->tests*ps, s->tests*pf);
+    printf("%-23s %12.2f %12.2f\n", "skipped by ym > 0", s->skipped*ps, s->skipped*pf);
+    printf("%-23s %12.2f %12.2f\n", "overlaps resolved", s->resolved*ps, s->resolved*pf);
+    printf("%-23s %12.4f %12.4f\n", "wall clamps", s->clamps*ps, s->clamps*pf);
+    printf("%-23s %12.4f %12.4f\n", "goal exits", ex*ps, ex*pf);
+    printf("%-23s %12.4f %12.4f\n", "lost off the sides", s->exits[SCORE_LOST]*ps, s->exits[SCORE_LOST]*pf);
+    printf("%.2f substeps a frame, penetration as a share of the summed radii:\n", (double)s->substeps*pf);
+    for(int i=0; i < STATS_DEPTHS; i++)
+    {
+        if(i < STATS_DEPTHS-1)
+            printf("  >1/%-6.0f %5.1f%%", pow(4.0, i+1), s->resolved > 0 ? 100.0 * s->depth[i] / s->resolved : 0.0);
+        else
+            printf("  less      %5.1f%%", s->resolved > 0 ? 100.0 * s->depth[i] / s->resolved : 0.0);
+        if(i % 4 == 3){printf("\n");}
+    }
+}
+#endif
+
+typedef struct
+{
+    coin* coins;
+    unsigned int num_coins;     // slots in use
+    unsigned int max_coins;     // pool capacity
+    unsigned int layout_coins;  // pitch coins the opening layout is filled to
+    f32 coin_r;                 // pitch coin radius
+
+    // uniform grid broadphase over the pitch coins, rebuilt every substep
+    // or only once it has gone stale, depending on the quality tier
+    int* bp_start;  // bp_w*bp_h+1 offsets into bp_items
+    int* bp_items;  // coin indices sorted by cell
+    int* bp_cand;   // per coin candidate scratch
+    int bp_w, bp_h;
+    f32 bp_rcell;
+    cpos bp_cell;
+    cpos* bp_pos;   // x,y of every pitch coin when the grid was built
+    cpos bp_slack;  // how far a coin may move before the grid misses pairs
+    cpos bp_half;   // the same when neither coin of a pair is where it was binned
+    uint bp_dirty;  // a coin moved further than that since the build
+    uint* bp_moved; // strip solver, coins pushed past bp_half during the passes
+    uint bp_audit;  // --fuzz checks every gather against every coin
+    unsigned int bp_missed; // touching pairs the audited gathers left out
+    unsigned int tick; // substeps so far, seeds the collision jitter
+
+    scoreev* events;         // coins that left the pitch in the last stepTable(),
+    unsigned int num_events; // at most one per slot so it is max_coins long
+    scoreev* left;           // slot indexed leavers while the strip solver runs
+    unsigned int* moves;     // from,to slot pairs tableCompact() moved in the
+    unsigned int num_moves;  // last stepTable(), so is 2*max_coins long
+    uint par;                // 1 while the strip solver runs
+
+    uint quality;       // QUALITY_* tier it is simulated at
+    cacc push;          // push banked by a tier that steps every few ticks
+    uint push_ticks;    // ticks banked so far
+    uint coarse;        // this push has had steps below the focus tier
+
+    heatmap* heat;      // NULL unless the table is being tallied
+#ifdef PHYS_STATS
+    physstats stats_frame;   // every substep of the last stepTable()
+#endif
+
+    f32 gold_stack;  // defining these as float32 eliminates the need to cast in mTranslate()
+    f32 silver_stack;// function due to the use of a float32 also in the for(f32 i;) loop.
+    unsigned int active_coin;
+    uint inmotion;
+    uint isnewcoin;
+    char trophies_bits;
+} table;
+table tbl = {0};
+
+#define DEFAULT_COINS 127
+#define BP_X0 -3.6f  // broadphase bounds, the pitch plus the drop lane and goals
+#define BP_Y0 -4.9f
+#define BP_X1  3.6f
+#define BP_Y1  4.7f
+
+// Physics quality tiers. A table that isn't being looked at takes its
+// push in bigger steps every few ticks and only rebuilds the broadphase
+// when it has gone stale. Whenever a push that had coarse steps comes to
+// rest it gets QUALITY_SETTLE rounds of substeps at the focus tier, which
+// leaves the coins overlapping no more than the focus tier leaves them.
+#define QUALITY_FOCUS      0 // on screen with focus
+#define QUALITY_BACKGROUND 1 // on screen, something else has focus
+#define QUALITY_HIDDEN     2 // not on screen at all
+#define QUALITY_SETTLE     4
+typedef struct
+{
+    uint every;     // steps once in this many ticks
+    uint substeps;  // collision passes per step
+    uint rebuild;   // 1 rebuilds the grid every pass, 0 only when stale
+} tier;
+const tier tiers[3] = {
+    {1, 6, 1}, // six seems enough
+    {2, 6, 0},
+    {4, 8, 0}
+};
 
 
 //*************************************
@@ -191,6 +394,47 @@ forceinline int fRand(const f32 min, const f32 max)
 #endif
 }
 
+// xorshift32, gives the layout generator its own stream so it can run
+// off the main thread without touching the rand() the game plays with
+forceinline unsigned int xrand(unsigned int* s)
+{
+    unsigned int x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *s = x;
+}
+
+forceinline f32 xrandFloat(unsigned int* s, const f32 min, const f32 max)
+{
+    return min + ((f32)(xrand(s) >> 8) * 5.9604645e-08f) * (max-min);
+}
+
+forceinline int xrandInt(unsigned int* s, const int min, const int max)
+{
+    return min + (int)(xrand(s) % (unsigned int)(max+1-min));
+}
+
+// writes the 32 bit field at p little endian whatever the host is
+forceinline void fputLE32(FILE* f, const void* p)
+{
+    unsigned int v;
+    memcpy(&v, p, 4);
+    const unsigned char b[4] = {v, v >> 8, v >> 16, v >> 24};
+    fwrite(b, 4, 1, f);
+}
+
+// reads a little endian 32 bit field into p, returns 0 at the end of f
+forceinline int fgetLE32(FILE* f, void* p)
+{
+    unsigned char b[4];
+    if(fread(b, 4, 1, f) != 1)
+        return 0;
+    const unsigned int v = b[0] | (b[1] << 8) | (b[2] << 16) | ((unsigned int)b[3] << 24);
+    memcpy(p, &v, 4);
+    return 1;
+}
+
 forceinline f32 f32Time()
 {
 #ifdef BUILD_GLFW
@@ -200,423 +444,4138 @@ forceinline f32 f32Time()
 #endif
 }
 
-void setActiveCoin(const uint color)
+// grows the coin pool so it holds at least n coins
+int tableReserve(table* tb, const unsigned int n)
+{
+    if(n <= tb->max_coins)
+        return 1;
+    unsigned int nm = tb->max_coins < 32 ? 32 : tb->max_coins;
+    while(nm < n){nm *= 2;}
+    coin* nc = realloc(tb->coins, nm * sizeof(coin));
+    if(nc == NULL){return 0;}
+    tb->coins = nc;
+    int* ni = realloc(tb->bp_items, nm * sizeof(int));
+    if(ni == NULL){return 0;}
+    tb->bp_items = ni;
+    ni = realloc(tb->bp_cand, nm * sizeof(int));
+    if(ni == NULL){return 0;}
+    tb->bp_cand = ni;
+    cpos* np = realloc(tb->bp_pos, nm * 2 * sizeof(cpos));
+    if(np == NULL){return 0;}
+    tb->bp_pos = np;
+    uint* nu = realloc(tb->bp_moved, nm * sizeof(uint));
+    if(nu == NULL){return 0;}
+    tb->bp_moved = nu;
+    scoreev* ne = realloc(tb->events, nm * sizeof(scoreev));
+    if(ne == NULL){return 0;}
+    tb->events = ne;
+    ne = realloc(tb->left, nm * sizeof(scoreev));
+    if(ne == NULL){return 0;}
+    tb->left = ne;
+    for(unsigned int i=tb->max_coins; i < nm; i++)
+        tb->left[i].kind = 0xff;
+    unsigned int* nv = realloc(tb->moves, nm * 2 * sizeof(unsigned int));
+    if(nv == NULL){return 0;}
+    tb->moves = nv;
+    tb->max_coins = nm;
+    return 1;
+}
+
+// sets up an empty table, the opening layout will be filled to
+// layout_coins pitch coins of radius coin_r
+int tableInit(table* tb, const unsigned int layout_coins, const f32 coin_r)
+{
+    memset(tb, 0, sizeof(table));
+    tb->layout_coins = layout_coins;
+    tb->coin_r = coin_r;
+
+    // cells are 3 coin radii, two touching coins plus a coin radius of
+    // slack for coins that move after the grid was built, less the reach
+    // the collision jitter adds
+    const f32 cell = coin_r * 3.f;
+    tb->bp_rcell = 1.f / cell;
+    tb->bp_cell = F2P(cell);
+    tb->bp_slack = F2P(coin_r - 0.01f);
+    tb->bp_half = F2P((coin_r - 0.01f) * 0.5f);
+    tb->bp_w = (int)ceilf((BP_X1-BP_X0) * tb->bp_rcell);
+    tb->bp_h = (int)ceilf((BP_Y1-BP_Y0) * tb->bp_rcell);
+    tb->bp_start = malloc((tb->bp_w*tb->bp_h+1) * sizeof(int));
+    if(tb->bp_start == NULL)
+        return 0;
+    return tableReserve(tb, 3 + layout_coins);
+}
+
+// frees what tableInit() and tableReserve() allocated
+void tableFree(table* tb)
+{
+    free(tb->coins);
+    free(tb->bp_start);
+    free(tb->bp_items);
+    free(tb->bp_cand);
+    free(tb->bp_pos);
+    free(tb->bp_moved);
+    free(tb->events);
+    free(tb->left);
+    free(tb->moves);
+    memset(tb, 0, sizeof(table));
+}
+
+// returns a free slot at the end of the pool, -1 if the pool can't grow
+int coinNew(table* tb)
 {
-    for(int i=0; i < MAX_COINS; i++)
+    if(tableReserve(tb, tb->num_coins+1) == 0)
+        return -1;
+    tb->bp_dirty = 1;
+    return tb->num_coins++;
+}
+
+// packs the live coins below num_coins again by moving the last coin into
+// every hole stepCollisions() left, the trophy slots are never moved
+void tableCompact(table* tb)
+{
+    coin* c = tb->coins;
+    unsigned int n = tb->num_coins;
+    for(unsigned int i=3; i < n;)
     {
-        if(coins[i].color == -1)
-        {
-            coins[i].color = color;
-            active_coin = i;
-            return;
-        }
+        if(c[i].color != -1){i++; continue;}
+        n--;
+        if(i == n){break;}
+        c[i] = c[n];
+        tb->bp_dirty = 1;
+        tb->moves[tb->num_moves++] = n;
+        tb->moves[tb->num_moves++] = i;
+        if(tb->active_coin == n)
+            tb->active_coin = i;
     }
+    tb->num_coins = n;
 }
 
-void takeStack()
+void setActiveCoin(table* tb, const uint color)
 {
-    if(gameover != 0.f)
+    const int i = coinNew(tb);
+    if(i == -1)
         return;
-    
-    if(silver_stack != 0.f)
+    tb->coins[i].color = color;
+    tb->coins[i].r = F2P(tb->coin_r);
+    tb->active_coin = i;
+}
+
+// drops the next coin off the stacks at pitch x
+void takeStack(table* tb, const f32 x)
+{
+    if(tb->silver_stack != 0.f)
     {
         // play a silver coin
-        isnewcoin = 1;
-        setActiveCoin(0);
-        inmotion = 1;
+        tb->isnewcoin = 1;
+        setActiveCoin(tb, 0);
+        tb->inmotion = 1;
     }
-    else if(gold_stack != 0.f)
+    else if(tb->gold_stack != 0.f)
     {
         // play a gold coin
-        isnewcoin = 2;
-        setActiveCoin(1);
-        inmotion = 1;
+        tb->isnewcoin = 2;
+        setActiveCoin(tb, 1);
+        tb->inmotion = 1;
     }
 
-    if(inmotion == 1)
+    if(tb->inmotion == 1)
     {
-        if(mx < touch_margin)
-        {
-            coins[active_coin].x = -1.90433f;
-            coins[active_coin].y = -4.54055f;
-            return;
-        }
-        
-        if(mx > ww-touch_margin)
-        {
-            coins[active_coin].x = 1.90433f;
-            coins[active_coin].y = -4.54055f;
-            return;
-        }
-        
-        coins[active_coin].x = -1.90433f+(((mx-touch_margin)*rww)*3.80866f);
-        coins[active_coin].y = -4.54055f;
+        tb->coins[tb->active_coin].x = F2P(x);
+        tb->coins[tb->active_coin].y = F2P(-4.54055f);
     }
 }
 
-void injectFigure()
+// pushes in a figure if a trophy slot is free, drawing it from rand() or,
+// when seed is not NULL, from that stream
+void injectFigure(table* tb, unsigned int* seed)
 {
-    if(inmotion != 0)
+    if(tb->inmotion != 0)
         return;
-    
+
     int fcn = -1;
     for(int i=0; i < 3; i++)
     {
-        if(coins[i].color == -1)
+        if(tb->coins[i].color == -1)
         {
-            active_coin = i;
+            tb->active_coin = i;
             fcn = i;
-            coins[i].color = fRand(1, 6);
+            tb->coins[i].color = seed != NULL ? xrandInt(seed, 1, 6) : fRand(1, 6);
             break;
         }
     }
 
     if(fcn != -1)
     {
-        coins[active_coin].x = fRandFloat(-1.90433f, 1.90433f);
-        coins[active_coin].y = -4.54055f;
-        inmotion = 1;
+        const f32 x = seed != NULL ? xrandFloat(seed, -1.90433f, 1.90433f) : fRandFloat(-1.90433f, 1.90433f);
+        tb->coins[tb->active_coin].x = F2P(x);
+        tb->coins[tb->active_coin].y = F2P(-4.54055f);
+        tb->inmotion = 1;
     }
 }
 
-int insidePitch(const f32 x, const f32 y, const f32 r)
+//*************************************
+// pitch geometry
+//*************************************
+
+// The pitch is described by its right hand outline from the pusher front
+// upwards, the left hand side is the mirror image. Each vertex also says
+// what the edge from it up to the next vertex is, the last vertex's edge
+// runs straight up forever and the first edge is reflected below the
+// first vertex (the space behind the pusher front).
+#define PITCH_WALL   0 // keeps coins on the pitch
+#define PITCH_LOST   1 // coins over it fall off the sides
+#define PITCH_SILVER 2 // coins over it pay into the silver stack
+#define PITCH_OPEN   3 // no edge at all
+#define PITCH_GOLD   4 // coins inside it pay into the gold stack, outside into the silver
+#define PITCH_MAX    64
+typedef struct
+{
+    f32 x, y;
+    int kind;
+} pvert;
+
+const pvert pitch_default[] = {
+    { 2.22482f,  -4.03414f,  PITCH_WALL},   // pusher front
+    { 2.99749f,  -2.22855f,  PITCH_WALL},
+    { 3.40863f,  -0.292027f, PITCH_WALL},
+    { 3.40863f,   1.64f,     PITCH_LOST},
+    { 3.341074f,  1.64f,     PITCH_LOST},   // first house goal
+    { 2.9975f,    2.58397f,  PITCH_LOST},   // second house goal
+    { 1.65169f,   3.70642f,  PITCH_SILVER}, // silver goal
+    { 0.584316f,  4.10583f,  PITCH_OPEN},
+    { 0.584316f,  4.31457f,  PITCH_GOLD},   // gold goal
+};
+
+// One band of the pitch, both edges are x = x0 + s*|y - y0|.
+// Bands are found through a y indexed table of 1/64 unit rows that covers
+// every y a cpos can hold, each row knows the band at its bottom and the
+// band above the one boundary that may cross it, so finding the band of
+// any y is one lookup and one compare. Edges shorter than a row are
+// dropped when the outline is loaded.
+typedef struct
+{
+    cpos xl, xr, y0, y1; // y0 to y1 is the band, y1 is the next band's y0
+    cacc sl, sr;
+    int region;
+} pedge;
+
+typedef struct
+{
+    cpos split;        // y where the row changes band
+    unsigned char lo, hi;
+} prow;
+
+#define PITCH_ROWS 1024 // -8 to +8 at 64 rows a unit
+struct
+{
+    pedge edge[PITCH_MAX];
+    int num_edges;
+    prow row[PITCH_ROWS];
+    f32 x0, y0, x1, y1; // walled part of the pitch, where openings are laid out
+} pitch;
+
+#ifdef FIXED_POINT
+    #define PITCH_TOP 32767
+    #define F2S(s) ((cacc)((s)*4096.f + ((s) < 0.f ? -0.5f : 0.5f)))
+    #define PITCH_ROWY(i) ((cacc)(i)*64 - 32768)
+#else
+    #define PITCH_TOP 8.f
+    #define F2S(s) (s)
+    #define PITCH_ROWY(i) ((f32)(i)*0.015625f - 8.f)
+#endif
+
+// builds the pitch bands and row table from n outline vertices,
+// returns 0 if the outline is unusable
+int pitchInit(const pvert* v, const int n)
 {
-    // off bottom
-    if(y < -4.03414f+r)
+    if(n < 1 || n > PITCH_MAX)
         return 0;
-    
-    // first left & right
-    if(y < -2.22855f)
+
+    int ne = 0;
+    pitch.x1 = 0.f;
+    pitch.y0 = v[0].y;
+    pitch.y1 = v[0].y;
+    for(int k=0; k < n; k++)
     {
-        if(x < (-2.22482f - (0.77267f*(fabsf(y+4.03414f) * 0.553835588f))) + r)
-            return 0;
-        else if(x > (2.22482f + (0.77267f*(fabsf(y+4.03414f) * 0.553835588f))) - r)
-            return 0;
+        f32 s = 0.f;
+        if(k+1 < n)
+        {
+            const f32 dy = v[k+1].y - v[k].y;
+            if(dy < 0.f || v[k].x < 0.f || v[k].kind < PITCH_WALL || v[k].kind > PITCH_GOLD)
+                return 0;
+            if(dy < 0.015625f)
+                continue;
+            s = (v[k+1].x - v[k].x) / dy;
+            if(s > 8.f){s = 8.f;}else if(s < -8.f){s = -8.f;} // keeps PWALL() in int32
+        }
+        pedge* e = &pitch.edge[ne];
+        e->xr = F2P(v[k].x);
+        e->xl = -e->xr;
+        e->sr = F2S(s);
+        e->sl = -e->sr;
+        e->y0 = F2P(v[k].y);
+        e->y1 = PITCH_TOP;
+        e->region = v[k].kind;
+        if(ne > 0)
+            pitch.edge[ne-1].y1 = e->y0;
+        ne++;
+
+        if(v[k].kind == PITCH_WALL)
+        {
+            const pvert* t = k+1 < n ? &v[k+1] : &v[k];
+            if(v[k].x > pitch.x1){pitch.x1 = v[k].x;}
+            if(t->x > pitch.x1){pitch.x1 = t->x;}
+            pitch.y1 = t->y;
+        }
     }
-    else if(y < -0.292027f) // second left & right
+    pitch.num_edges = ne;
+    pitch.x0 = -pitch.x1;
+
+    // rows
+    int lo = 0;
+    for(int i=0; i < PITCH_ROWS; i++)
     {
-        if(x < (-2.99749f - (0.41114f*(fabsf(y+2.22855f) * 0.516389426f))) + r)
-            return 0;
-        else if(x > (2.99749f + (0.41114f*(fabsf(y+2.22855f) * 0.516389426f))) - r)
-            return 0;
+        const cacc ya = PITCH_ROWY(i), yb = PITCH_ROWY(i+1);
+        while(lo+1 < ne && pitch.edge[lo].y1 <= ya){lo++;}
+        pitch.row[i].lo = lo;
+        pitch.row[i].hi = lo+1 < ne && pitch.edge[lo].y1 < yb ? lo+1 : lo;
+        pitch.row[i].split = pitch.edge[lo].y1;
+    }
+    return 1;
+}
+
+// Outline files are plain text, one "x y kind" vertex per line where kind
+// is wall, lost, silver, open or gold. Lines starting with # are ignored.
+int pitchLoad(const char* fname)
+{
+    FILE* f = fopen(fname, "r");
+    if(f == NULL)
+    {
+        printf("WARNING: could not open pitch file %s\n", fname);
+        return 0;
     }
-    else if(y < 1.45439f) // third left & right
+    pvert v[PITCH_MAX];
+    int n = 0;
+    char line[256], kind[32];
+    while(fgets(line, sizeof(line), f) != NULL)
     {
-        if(x < -3.40863f + r)
+        if(line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            continue;
+        if(n == PITCH_MAX || sscanf(line, "%f %f %31s", &v[n].x, &v[n].y, kind) != 3)
+        {
+            printf("WARNING: bad line in pitch file %s: %s", fname, line);
+            fclose(f);
             return 0;
-        else if(x > 3.40863f - r)
+        }
+#ifdef FIXED_POINT
+        // a cpos only holds +/- 8 units, past that F2P() wraps
+        const f32 pmax = 32767.f/4096.f;
+        if(!(v[n].x >= -pmax && v[n].x <= pmax && v[n].y >= -pmax && v[n].y <= pmax))
+        {
+            printf("WARNING: pitch file %s is outside the +/- 8 units of FIXED_POINT: %s", fname, line);
+            fclose(f);
             return 0;
+        }
+#endif
+        if(strcmp(kind, "wall") == 0)        {v[n].kind = PITCH_WALL;}
+        else if(strcmp(kind, "lost") == 0)   {v[n].kind = PITCH_LOST;}
+        else if(strcmp(kind, "silver") == 0) {v[n].kind = PITCH_SILVER;}
+        else if(strcmp(kind, "open") == 0)   {v[n].kind = PITCH_OPEN;}
+        else if(strcmp(kind, "gold") == 0)   {v[n].kind = PITCH_GOLD;}
+        else{v[n].kind = -1;}
+        n++;
     }
+    fclose(f);
+    if(pitchInit(v, n) == 0)
+    {
+        printf("WARNING: %s is not a usable pitch outline\n", fname);
+        return 0;
+    }
+    return 1;
+}
+
+// the band that holds y
+forceinline const pedge* pitchEdge(const cpos y)
+{
+#ifdef FIXED_POINT
+    const prow* r = &pitch.row[((cacc)y + 32768) >> 6];
+#else
+    int i = (int)((y + 8.f) * 64.f);
+    if(i < 0){i = 0;}else if(i > PITCH_ROWS-1){i = PITCH_ROWS-1;}
+    const prow* r = &pitch.row[i];
+#endif
+    return &pitch.edge[y < r->split ? r->lo : r->hi];
+}
+
+int insidePitch(const f32 x, const f32 y, const f32 r)
+{
+    // off bottom, in cpos under FIXED_POINT to agree with the layout sampler
+#ifdef FIXED_POINT
+    if((cacc)F2P(y) < (cacc)F2P(pitch.y0) + F2P(r))
+#else
+    if(y < pitch.y0+r)
+#endif
+        return 0;
 
+    const pedge* e = pitchEdge(F2P(y));
+    if(e->region != PITCH_WALL)
+        return 1;
+    if(x < P2F(PWALL(e->xl, e->sl, e->y0, F2P(y))) + r)
+        return 0;
+    else if(x > P2F(PWALL(e->xr, e->sr, e->y0, F2P(y))) - r)
+        return 0;
     return 1;
 }
 
-int collision(int ci)
+//*************************************
+// opening layout
+//*************************************
+
+// Bridson's Poisson-disk sampler clipped to insidePitch(), every placed
+// coin spawns up to PD_TRIES candidates in the annulus around it so the
+// whole fill costs at most (placed * PD_TRIES) tests no matter the CPU.
+// Candidates are drawn from a narrow annulus [d, 1.2d] rather than the
+// textbook [d, 2d], this packs the pitch about as dense as the old 33ms
+// rejection fill managed on a fast machine.
+// The acceleration grid cell is the pitch coin diameter over sqrt(2) so
+// no two pitch coins can share a cell.
+// Under FIXED_POINT the sampler draws and tests in cpos with integer
+// xrand() and a table of directions, so the opening does not depend on
+// the libm or the float flags of the build.
+#define PD_X0   pitch.x0        // grid origin, bottom left of the walled pitch
+#define PD_Y0   pitch.y0
+#define PD_X1   pitch.x1
+#define PD_Y1   pitch.y1
+#define PD_TRIES 30
+#ifdef FIXED_POINT
+    #define PD_DIRS 256         // directions around the annulus
+    #define pdRand(s, min, max) ((cpos)xrandInt(s, F2P(min), F2P(max)))
+#else
+    #define pdRand(s, min, max) xrandFloat(s, min, max)
+#endif
+typedef struct
+{
+    int* cell;  // coin index + 1, 0 = empty cell
+    int w, h;
+#ifdef FIXED_POINT
+    cacc size;  // cell size in cpos
+#else
+    f32 rcell;
+#endif
+    int reach;  // cells to search either side for a trophy sized overlap
+} pdgrid;
+
+#ifdef FIXED_POINT
+// cos over the first quarter turn in PD_DIRS steps, Q1.14
+const short pd_cos[PD_DIRS/4+1] =
+{
+    16384, 16379, 16364, 16340, 16305, 16261, 16207, 16143, 16069, 15986, 15893, 15791, 15679,
+    15557, 15426, 15286, 15137, 14978, 14811, 14635, 14449, 14256, 14053, 13842, 13623, 13395,
+    13160, 12916, 12665, 12406, 12140, 11866, 11585, 11297, 11003, 10702, 10394, 10080, 9760,
+    9434, 9102, 8765, 8423, 8076, 7723, 7366, 7005, 6639, 6270, 5897, 5520, 5139,
+    4756, 4370, 3981, 3590, 3196, 2801, 2404, 2006, 1606, 1205, 804, 402, 0
+};
+
+// unit direction d of PD_DIRS in Q1.14, the other three quarters by symmetry
+forceinline void pdDir(const unsigned int d, cacc* dx, cacc* dy)
+{
+    const unsigned int q = (d / (PD_DIRS/4)) & 3, m = d % (PD_DIRS/4);
+    const cacc cs = pd_cos[m], sn = pd_cos[PD_DIRS/4-m];
+    if(q == 0){*dx =  cs; *dy =  sn;}
+    else if(q == 1){*dx = -sn; *dy =  cs;}
+    else if(q == 2){*dx = -cs; *dy = -sn;}
+    else{*dx =  sn; *dy = -cs;}
+}
+#endif
+
+forceinline int pdCellX(const pdgrid* g, const cpos x)
+{
+#ifdef FIXED_POINT
+    int gx = ((cacc)x - F2P(PD_X0)) / g->size;
+#else
+    int gx = (int)((x - PD_X0) * g->rcell);
+#endif
+    if(gx < 0){gx = 0;}else if(gx >= g->w){gx = g->w-1;}
+    return gx;
+}
+
+forceinline int pdCellY(const pdgrid* g, const cpos y)
+{
+#ifdef FIXED_POINT
+    int gy = ((cacc)y - F2P(PD_Y0)) / g->size;
+#else
+    int gy = (int)((y - PD_Y0) * g->rcell);
+#endif
+    if(gy < 0){gy = 0;}else if(gy >= g->h){gy = g->h-1;}
+    return gy;
+}
+
+// returns 1 if a coin of radius r fits at x,y without touching the pitch
+// walls or any coin already in the grid
+forceinline int pdFits(const coin* c, const pdgrid* g, const cpos x, const cpos y, const cpos r)
 {
-    for(int i=0; i < MAX_COINS; i++)
+#ifdef FIXED_POINT
+    // insidePitch() in cpos
+    if((cacc)y > F2P(PD_Y1) - r || (cacc)y < F2P(PD_Y0) + r)
+        return 0;
+    const pedge* e = pitchEdge(y);
+    if(e->region == PITCH_WALL && ((cacc)x < PWALL(e->xl, e->sl, e->y0, y) + r ||
+                                   (cacc)x > PWALL(e->xr, e->sr, e->y0, y) - r))
+        return 0;
+#else
+    if(y > PD_Y1-r || insidePitch(x, y, r) == 0)
+        return 0;
+#endif
+
+    const int gx = pdCellX(g, x), gy = pdCellY(g, y), k = g->reach;
+    const int x0 = gx > k ? gx-k : 0, x1 = gx < g->w-1-k ? gx+k : g->w-1;
+    const int y0 = gy > k ? gy-k : 0, y1 = gy < g->h-1-k ? gy+k : g->h-1;
+    for(int cy = y0; cy <= y1; cy++)
     {
-        if(i == ci || coins[i].color == -1){continue;}
-        const f32 xm = (coins[i].x - coins[ci].x);
-        const f32 ym = (coins[i].y - coins[ci].y);
-        const f32 radd = coins[i].r+coins[ci].r;
-        if(xm*xm + ym*ym < radd*radd)
-            return 1;
+        for(int cx = x0; cx <= x1; cx++)
+        {
+            const int ci = g->cell[cy*g->w + cx];
+            if(ci == 0){continue;}
+            const coin* o = &c[ci-1];
+            const cacc xm = (cacc)o->x - x;
+            const cacc ym = (cacc)o->y - y;
+            const cacc radd = (cacc)o->r + r;
+#ifdef FIXED_POINT
+            if(xm >= radd || xm <= -radd || ym >= radd || ym <= -radd){continue;}
+#endif
+            if(xm*xm + ym*ym < radd*radd)
+                return 0;
+        }
     }
-    return 0;
+    return 1;
 }
 
-uint stepCollisions()
+forceinline void pdInsert(coin* c, pdgrid* g, const int i)
 {
-    uint was_collision = 0;
-    for(int i=0; i < MAX_COINS; i++)
-    {
-        if(coins[i].color == -1){continue;}
-        for(int j=0; j < MAX_COINS; j++)
-        {
-            if(i == j || coins[j].color == -1 || j == active_coin){continue;}
-            f32 xm = (coins[i].x - coins[j].x);
-            xm += fRandFloat(-0.01f, 0.01f); // add some random offset to our unit vector, very subtle but works so well!
-            const f32 ym = (coins[i].y - coins[j].y);
-            f32 d = xm*xm + ym*ym;
-            const f32 cr = coins[i].r+coins[j].r;
-            if(d < cr*cr)
-            {
-                d = sqrtps(d);
-                const f32 len = 1.f/d;
-                const f32 uy = (ym * len);
-                if(uy > 0.f){continue;} // best hack ever to massively simplify
-                const f32 m = d-cr;
-                coins[j].x += (xm * len) * m;
-                coins[j].y += uy * m;
-
-                // first left & right
-                if(coins[j].y < -2.22855f)
-                {
-                    const f32 fl = (-2.22482f - (0.77267f*(fabsf(coins[j].y+4.03414f) * 0.553835588f))) + coins[j].r;
-                    if(coins[j].x < fl)
-                    {
-                        coins[j].x = fl;
-                    }
-                    else
-                    {
-                        const f32 fr = ( 2.22482f + (0.77267f*(fabsf(coins[j].y+4.03414f) * 0.553835588f))) - coins[j].r;
-                        if(coins[j].x > fr)
-                            coins[j].x = fr;
-                    }
-                }
-                else if(coins[j].y < -0.292027f) // second left & right
-                {
-                    const f32 fl = (-2.99749f - (0.41114f*(fabsf(coins[j].y+2.22855f) * 0.516389426f))) + coins[j].r;
-                    if(coins[j].x < fl)
-                    {
-                        coins[j].x = fl;
-                    }
-                    else
-                    {
-                        const f32 fr = (2.99749f + (0.41114f*(fabsf(coins[j].y+2.22855f) * 0.516389426f))) - coins[j].r;
-                        if(coins[j].x > fr)
-                            coins[j].x = fr;
-                    }
-                }
-                else if(coins[j].y < 1.64f) // third left & right
-                {
-                    const f32 fl = -3.40863f + coins[j].r;
-                    if(coins[j].x < fl)
-                    {
-                        coins[j].x = fl;
-                    }
-                    else
-                    {
-                        const f32 fr = 3.40863f - coins[j].r;
-                        if(coins[j].x > fr)
-                            coins[j].x = fr;
-                    }
-                }
-                else if(coins[j].y < 2.58397f) // first house goal
-                {
-                    const f32 fl = (-3.40863f + (0.41113f*(fabsf(coins[j].y-1.45439f) * 0.885284796f)));
-                    if(coins[j].x < fl)
-                    {
-                        coins[j].color = -1;
-                    }
-                    else
-                    {
-                        const f32 fr = (3.40863f - (0.41113f*(fabsf(coins[j].y-1.45439f) * 0.885284796f)));
-                        if(coins[j].x > fr)
-                            coins[j].color = -1;
-                    }
-                }
-                else if(coins[j].y < 3.70642f) // second house goal
-                {
-                    const f32 fl = (-2.9975f + (1.34581f*(fabsf(coins[j].y-2.58397f) * 0.890908281f)));
-                    if(coins[j].x < fl)
-                    {
-                        coins[j].color = -1;
-                    }
-                    else
-                    {
-                        const f32 fr = (2.9975f - (1.34581f*(fabsf(coins[j].y-2.58397f) * 0.890908281f)));
-                        if(coins[j].x > fr)
-                            coins[j].color = -1;
-                    }
-                }
-                else if(coins[j].y < 4.10583f) // silver goal
-                {
-                    const f32 fl = (-1.65169f + (1.067374f*(fabsf(coins[j].y-3.70642f) * 2.503692947f)));
-                    if(coins[j].x < fl)
-                    {
-                        if(j >= 0 && j <= 3)
-                        {
-                            if(trophies_get(coins[j].color-1)) // already have? then reward coins!
-                            {
-                                gold_stack += 6.f;
-                                silver_stack += 6.f;
-                            }
-                            else
-                                trophies_set(coins[j].color-1);
-                        }
-                        else
-                        {
-                            if(coins[j].color == 0)
-                                silver_stack += 1.f;
-                            else if(coins[j].color == 1)
-                                silver_stack += 2.f;
-                        }
+    g->cell[pdCellY(g, c[i].y)*g->w + pdCellX(g, c[i].x)] = i+1;
+}
 
-                        coins[j].color = -1;
-                    }
-                    else
-                    {
-                        const f32 fr = (1.65169f - (1.067374f*(fabsf(coins[j].y-3.70642f) * 2.503692947f)));
-                        if(coins[j].x > fr)
-                        {
-                            if(j >= 0 && j <= 3)
-                            {
-                                if(trophies_get(coins[j].color-1)) // already have? then reward coins!
-                                {
-                                    gold_stack += 6.f;
-                                    silver_stack += 6.f;
-                                }
-                                else
-                                    trophies_set(coins[j].color-1);
-                            }
-                            else
-                            {
-                                if(coins[j].color == 0)
-                                    silver_stack += 1.f;
-                                else if(coins[j].color == 1)
-                                    silver_stack += 2.f;
-                            }
-
-                            coins[j].color = -1;
-                        }
-                    }
-                }
-                else if(coins[j].y >= 4.31457f) // gold goal
-                {
-                    if(coins[j].x >= -0.584316f && coins[j].x <= 0.584316f)
-                    {
-                        if(j >= 0 && j <= 3)
-                        {
-                            if(trophies_get(coins[j].color-1)) // already have? then reward coins!
-                            {
-                                gold_stack += 6.f;
-                                silver_stack += 6.f;
-                            }
-                            else
-                                trophies_set(coins[j].color-1);
-                        }
-                        else
-                        {
-                            if(coins[j].color == 0)
-                                gold_stack += 1.f;
-                            else if(coins[j].color == 1)
-                                gold_stack += 2.f;
-                        }
+// fills c[0..2] with trophies and c[3..max-1] with as many pitch coins of
+// radius r as the pitch will hold, returns one past the last used index
+int layoutPoisson(coin* c, const int max, const f32 r, unsigned int* seed)
+{
+    pdgrid g;
+    const cpos rp = F2P(r), tr = F2P(TROPHY_R);
+#ifdef FIXED_POINT
+    g.size = (cacc)rp * 181 / 128; // 2r / sqrt(2), rounded down
+    if(g.size < 1){g.size = 1;}
+    g.w = ((cacc)F2P(PD_X1) - F2P(PD_X0) + g.size-1) / g.size;
+    g.h = ((cacc)F2P(PD_Y1) - F2P(PD_Y0) + g.size-1) / g.size;
+    g.reach = ((tr*2 > tr+rp ? tr*2 : tr+rp) + g.size-1) / g.size;
+    if(g.w < 1){g.w = 1;}
+    if(g.h < 1){g.h = 1;}
+#else
+    const f32 cell = r * 1.414213562f; // 2r / sqrt(2)
+    g.rcell = 1.f / cell;
+    g.w = (int)ceilf((PD_X1-PD_X0) * g.rcell);
+    g.h = (int)ceilf((PD_Y1-PD_Y0) * g.rcell);
+    g.reach = (int)ceilf((TROPHY_R*2.f > TROPHY_R+r ? TROPHY_R*2.f : TROPHY_R+r) * g.rcell);
+#endif
+    if(g.reach < 2){g.reach = 2;}
+    g.cell = calloc(g.w*g.h, sizeof(int));
+    int* active = malloc(max * sizeof(int));
+    if(g.cell == NULL || active == NULL)
+    {
+        free(g.cell);
+        free(active);
+        for(int i=0; i < 3; i++){c[i].color = -1;}
+        return 3;
+    }
+    int na = 0;
 
-                        coins[j].color = -1;
-                    }
-                    else
-                    {
-                        if(j >= 0 && j <= 3)
-                        {
-                            if(trophies_get(coins[j].color-1)) // already have? then reward coins!
-                            {
-                                gold_stack += 6.f;
-                                silver_stack += 6.f;
-                            }
-                            else
-                                trophies_set(coins[j].color-1);
-                        }
-                        else
-                            silver_stack += 1.f;
+    // trophies
+    for(int i=0; i < 3; i++)
+    {
+        c[i].color = -1;
+        c[i].r = tr;
+        for(int k=0; k < 256; k++)
+        {
+            const cpos x = pdRand(seed, PD_X0, PD_X1);
+            const cpos y = pdRand(seed, PD_Y0, PD_Y1-TROPHY_R);
+            if(pdFits(c, &g, x, y, tr) == 1)
+            {
+                c[i].x = x;
+                c[i].y = y;
+                c[i].color = xrandInt(seed, 1, 6);
+                pdInsert(c, &g, i);
+                active[na++] = i;
+                break;
+            }
+        }
+    }
 
-                        coins[j].color = -1;
-                    }
-                }
-                
-                was_collision++;
+    // coins
+    int n = 3;
+    if(na == 0 && n < max) // no trophy to grow from, seed one coin
+    {
+        for(int k=0; k < 256; k++)
+        {
+            const cpos x = pdRand(seed, PD_X0, PD_X1);
+            const cpos y = pdRand(seed, PD_Y0, PD_Y1-r);
+            if(pdFits(c, &g, x, y, rp) == 1)
+            {
+                c[n].x = x;
+                c[n].y = y;
+                c[n].r = rp;
+                c[n].color = 0;
+                pdInsert(c, &g, n);
+                active[na++] = n++;
+                break;
             }
         }
     }
-    return was_collision;
+    while(na > 0 && n < max)
+    {
+        const int ai = xrandInt(seed, 0, na-1);
+        const coin* a = &c[active[ai]];
+        const cacc mind = (cacc)a->r + rp;
+        uint placed = 0;
+        for(int k=0; k < PD_TRIES; k++)
+        {
+#ifdef FIXED_POINT
+            cacc dx, dy;
+            pdDir(xrand(seed), &dx, &dy);
+            const cacc dist = xrandInt(seed, mind, mind + mind/5);
+            const cacc xl = a->x + dx*dist/16384;
+            const cacc yl = a->y + dy*dist/16384;
+            if(xl < -32767 || xl > 32767 || yl < -32767 || yl > 32767){continue;}
+            const cpos x = xl, y = yl;
+#else
+            const f32 ang = xrandFloat(seed, 0.f, x2PI);
+            const f32 dist = xrandFloat(seed, mind, mind*1.2f);
+            const f32 x = a->x + cosf(ang)*dist;
+            const f32 y = a->y + sinf(ang)*dist;
+#endif
+            if(pdFits(c, &g, x, y, rp) == 1)
+            {
+                c[n].x = x;
+                c[n].y = y;
+                c[n].r = rp;
+                c[n].color = xrandInt(seed, 0, 4);
+                if(c[n].color > 1){c[n].color = 0;}
+                pdInsert(c, &g, n);
+                active[na++] = n++;
+                placed = 1;
+                break;
+            }
+        }
+        if(placed == 0) // exhausted, retire it
+            active[ai] = active[--na];
+    }
+
+    free(g.cell);
+    free(active);
+    return n;
+}
+
+//*************************************
+// collisions
+//*************************************
+
+forceinline int bpCell(const table* tb, const cpos x, const cpos y)
+{
+#ifdef FIXED_POINT
+    int gx = ((cacc)x - F2P(BP_X0)) / tb->bp_cell;
+    int gy = ((cacc)y - F2P(BP_Y0)) / tb->bp_cell;
+#else
+    int gx = (int)((x - BP_X0) * tb->bp_rcell);
+    int gy = (int)((y - BP_Y0) * tb->bp_rcell);
+#endif
+    if(gx < 0){gx = 0;}else if(gx >= tb->bp_w){gx = tb->bp_w-1;}
+    if(gy < 0){gy = 0;}else if(gy >= tb->bp_h){gy = tb->bp_h-1;}
+    return gy*tb->bp_w + gx;
+}
+
+// returns 1 if pitch coin j has moved further than lim either way since
+// the grid was built
+forceinline int bpDrift(const table* tb, const int j, const cpos lim)
+{
+    const cacc mx = (cacc)tb->coins[j].x - tb->bp_pos[j*2];
+    const cacc my = (cacc)tb->coins[j].y - tb->bp_pos[j*2+1];
+    return mx > lim || mx < -lim || my > lim || my < -lim;
+}
+
+// counting sort of the live pitch coins into their grid cells, the trophies
+// are left out and tested against everything directly as they are bigger
+void bpBuild(table* tb)
+{
+    const coin* c = tb->coins;
+    const int nc = tb->bp_w*tb->bp_h;
+    int* start = tb->bp_start;
+    memset(start, 0, (nc+1) * sizeof(int));
+    for(unsigned int i=3; i < tb->num_coins; i++)
+        if(c[i].color != -1)
+            start[bpCell(tb, c[i].x, c[i].y)+1]++;
+    for(int i=0; i < nc; i++)
+        start[i+1] += start[i];
+    for(unsigned int i=3; i < tb->num_coins; i++) // start[] ends up shifted one cell
+    {
+        if(c[i].color != -1)
+        {
+            tb->bp_items[start[bpCell(tb, c[i].x, c[i].y)]++] = i;
+            tb->bp_pos[i*2] = c[i].x;
+            tb->bp_pos[i*2+1] = c[i].y;
+        }
+    }
+    for(int i=nc; i > 0; i--)
+        start[i] = start[i-1];
+    start[0] = 0;
+    tb->bp_dirty = 0;
+}
+
+#ifdef FIXED_POINT
+// bit by bit integer square root, exact floor on every platform
+forceinline cacc isqrt(cacc v)
+{
+    cacc r = 0;
+    for(cacc b = 1 << 28; b != 0; b >>= 2)
+    {
+        if(v >= r + b)
+        {
+            v -= r + b;
+            r = (r >> 1) + b;
+        }
+        else
+            r >>= 1;
+    }
+    return r;
+}
+#endif
+
+// Deterministic stand in for the old rand() jitter, a hash of the substep
+// and the pair so it is the same on every build and every thread count.
+// The float build uses it too, on purpose: rand() is not safe to call
+// from the strip solver's workers or the simulation thread, and the
+// fuzzer needs every solver to see the same jitter. It is the same
+// +/- 0.01 spread so play feels the same, but a given drop no longer
+// lands where it did with rand() for the same srand() seed.
+forceinline cacc jitter(const table* tb, const int i, const int j)
+{
+    unsigned int h = tb->tick * 0x9E3779B1u ^ (unsigned int)i * 0x85EBCA77u ^ (unsigned int)j * 0xC2B2AE3Du;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+#ifdef FIXED_POINT
+    return (cacc)(h % 83u) - 41; // +/- 0.01
+#else
+    return ((f32)(h >> 8) * 1.1920929e-09f) - 0.01f; // 0.02 / 2^24
+#endif
+}
+
+// takes coin j off the pitch and queues how it left
+forceinline void leavePitch(table* tb, const int j, const int kind)
+{
+    scoreev* e = tb->par == 1 ? &tb->left[j] : &tb->events[tb->num_events++];
+    e->coin = j;
+    e->color = tb->coins[j].color;
+    e->kind = kind;
+    tb->coins[j].color = -1;
+    PSTAT(phys_stats.exits[kind]++);
+}
+
+// pushes coin j out of coin i, then clamps it to the walls or scores it
+// if it fell into a goal, returns 1 if they were overlapping
+static forceinline uint collidePair(table* tb, const int i, const int j)
+{
+    coin* c = tb->coins;
+    const cacc xm = (cacc)(c[i].x - c[j].x) + jitter(tb, i, j); // add some random offset to our unit vector, very subtle but works so well!
+    const cacc ym = (c[i].y - c[j].y);
+    PSTAT(phys_stats.tests++);
+    if(ym > 0){PSTAT(phys_stats.skipped++); return 0;} // best hack ever to massively simplify (the old uy > 0)
+    const cacc cr = c[i].r+c[j].r;
+#ifdef FIXED_POINT
+    if(xm >= cr || xm <= -cr || ym <= -cr){return 0;} // keeps the squares in range
+#endif
+    const cacc d2 = xm*xm + ym*ym;
+    if(d2 < cr*cr)
+    {
+#ifdef FIXED_POINT
+        const cacc d = isqrt(d2);
+        if(d == 0){return 0;}
+        const cacc m = d-cr;
+        c[j].x += (xm * m) / d;
+        c[j].y += (ym * m) / d;
+#else
+        const f32 d = sqrtps(d2);
+        const f32 len = 1.f/d;
+        const f32 m = d-cr;
+        c[j].x += (xm * len) * m;
+        c[j].y += (ym * len) * m;
+#endif
+#ifdef PHYS_STATS
+        int db = 0;
+        for(cacc lim = cr/4; db < STATS_DEPTHS-1 && -m < lim; lim /= 4)
+            db++;
+        phys_stats.depth[db]++;
+        phys_stats.resolved++;
+#endif
+
+        // walls and goals
+        const pedge* e = pitchEdge(c[j].y);
+        const cpos fl = PWALL(e->xl, e->sl, e->y0, c[j].y);
+        const cpos fr = PWALL(e->xr, e->sr, e->y0, c[j].y);
+        switch(e->region)
+        {
+            case PITCH_WALL:
+                if(c[j].x < fl + c[j].r)
+                {
+                    c[j].x = fl + c[j].r;
+                    PSTAT(phys_stats.clamps++);
+                }
+                else if(c[j].x > fr - c[j].r)
+                {
+                    c[j].x = fr - c[j].r;
+                    PSTAT(phys_stats.clamps++);
+                }
+                break;
+            case PITCH_LOST:
+                if(c[j].x < fl || c[j].x > fr)
+                    leavePitch(tb, j, SCORE_LOST);
+                break;
+            case PITCH_SILVER:
+                if(c[j].x < fl || c[j].x > fr)
+                    leavePitch(tb, j, SCORE_SILVER);
+                break;
+            case PITCH_GOLD:
+                if(c[j].x >= fl && c[j].x <= fr)
+                    leavePitch(tb, j, SCORE_GOLD);
+                else
+                    leavePitch(tb, j, SCORE_SPILL);
+                break;
+        }
+
+        // pushed out of reach of the grid, the index order solver rebuilds it
+        if(tb->par == 0 && j >= 3 && bpDrift(tb, j, tb->bp_slack) == 1)
+            tb->bp_dirty = 1;
+        
+        return 1;
+    }
+    return 0;
+}
+
+// gathers every coin that could touch coin i into cand in ascending
+// index order, which is the order the brute force loop would visit them,
+// searching around grid cell gx,gy
+forceinline int bpGatherAt(const table* tb, const int i, const int gx, const int gy, int* cand)
+{
+    const coin* c = tb->coins;
+    int n = 0;
+
+    // trophies are tested by everyone
+    for(int j=0; j < 3; j++)
+        if(j != i && c[j].color != -1)
+            cand[n++] = j;
+
+    // pitch coins from the neighbouring cells
+    const int k = i < 3 ? (int)ceilf((TROPHY_R + tb->coin_r*2.f) * tb->bp_rcell) : 1;
+    const int x0 = gx > k ? gx-k : 0, x1 = gx < tb->bp_w-1-k ? gx+k : tb->bp_w-1;
+    const int y0 = gy > k ? gy-k : 0, y1 = gy < tb->bp_h-1-k ? gy+k : tb->bp_h-1;
+    const int f = n;
+    for(int y = y0; y <= y1; y++)
+    {
+        const int row = y*tb->bp_w;
+        for(int p = tb->bp_start[row+x0]; p < tb->bp_start[row+x1+1]; p++)
+        {
+            const int j = tb->bp_items[p];
+            if(j == i){continue;}
+
+            // insertion sort, cells hold a handful of coins
+            int q = n++;
+            while(q > f && cand[q-1] > j){cand[q] = cand[q-1]; q--;}
+            cand[q] = j;
+        }
+    }
+    return n;
+}
+
+forceinline int bpGather(const table* tb, const int i, int* cand)
+{
+    const int cell = bpCell(tb, tb->coins[i].x, tb->coins[i].y);
+    return bpGatherAt(tb, i, cell % tb->bp_w, cell / tb->bp_w, cand);
+}
+
+// returns 1 if any pitch coin has moved further than lim since the grid
+// was built, for the strip solver which can't flag it in collidePair()
+int bpStale(const table* tb, const cpos lim)
+{
+    for(unsigned int i=3; i < tb->num_coins; i++)
+        if(tb->coins[i].color != -1 && bpDrift(tb, i, lim) == 1)
+            return 1;
+    return 0;
+}
+
+// brute force check of one gather for the fuzzer, counts every live coin
+// within reach of coin i that cand left out into missed, bar the coins
+// marked in skip if it isn't NULL
+void bpAudit(const table* tb, const unsigned int i, const int* cand, const int nc, const uint* skip, unsigned int* missed)
+{
+    const coin* c = tb->coins;
+    int q = 0;
+    for(unsigned int j=0; j < tb->num_coins; j++)
+    {
+        while(q < nc && (unsigned int)cand[q] < j){q++;}
+        if(j == i || c[j].color == -1 || (q < nc && (unsigned int)cand[q] == j)){continue;}
+        if(skip != NULL && j >= 3 && skip[j] == 1){continue;}
+        const f32 dx = P2F((cacc)c[i].x - c[j].x);
+        const f32 dy = P2F((cacc)c[i].y - c[j].y);
+        const f32 cr = P2F((cacc)c[i].r + c[j].r) + 0.01f; // and the jitter
+        if(dx*dx + dy*dy < cr*cr)
+            (*missed)++;
+    }
+}
+
+//*************************************
+// strip solver
+//*************************************
+
+// With --threads the substep is solved in broadphase rows rather than in
+// plain index order. A pitch coin only reaches the rows either side of its
+// own so rows three apart never touch the same coin, the rows are solved
+// in three passes (row % 3) and the rows of a pass are shared between the
+// workers. Each row is always solved in the same order by one worker so
+// the result does not depend on how many threads there are. Trophies
+// reach every row so their pairs are solved first on the calling thread.
+// The grid is built once a substep and the passes never rebuild it, so
+// every coin is solved once, in the row it was binned in. The rows only
+// find every pair while no coin is further than bp_half from its bin, so
+// the coins the trophies pushed further are marked in bp_moved before the
+// passes and a worker marks the coins it pushes further, which all lie in
+// its own rows. A marked coin sits out the rest of the passes and the
+// calling thread settles the marked coins against everything around them,
+// both ways round in index order on a rebuilt grid, once they are done.
+// Coins that leave the pitch during the passes are marked in their slot
+// and queued in slot order once the passes are done.
+#define SOLVER_MAX_THREADS 64
+typedef struct
+{
+    int id;
+    int* cand;  // this worker's bpGather() scratch
+    unsigned int cand_max;
+    uint hits;
+    unsigned int missed; // bp_missed of this worker's gathers
+#ifdef PHYS_STATS
+    physstats stats; // what this worker counted in the passes of this substep
+#endif
+} solverjob;
+
+struct
+{
+    int threads;    // 0 = single threaded index order solver
+    solverjob job[SOLVER_MAX_THREADS];
+    pthread_barrier_t start, done;
+    table* tb;      // what the workers solve next
+    int pass;
+} solver;
+
+void solveRows(table* tb, const int pass, solverjob* jb)
+{
+    coin* c = tb->coins;
+    for(int y = pass + 3*jb->id; y < tb->bp_h; y += 3*solver.threads)
+    {
+        const int end = tb->bp_start[(y+1)*tb->bp_w];
+        for(int p = tb->bp_start[y*tb->bp_w]; p < end; p++)
+        {
+            const int i = tb->bp_items[p];
+            if(c[i].color == -1 || tb->bp_moved[i] == 1){continue;}
+            if(bpDrift(tb, i, tb->bp_half) == 1)
+            {
+                tb->bp_moved[i] = 1;
+                continue;
+            }
+
+            // search around the row the coin was binned in, not where it
+            // is now, so this worker never reaches into another's rows
+            const int gx = bpCell(tb, c[i].x, c[i].y) % tb->bp_w;
+            const int nc = bpGatherAt(tb, i, gx, y, jb->cand);
+            if(tb->bp_audit == 1)
+                bpAudit(tb, i, jb->cand, nc, tb->bp_moved, &jb->missed);
+            for(int q=0; q < nc; q++)
+            {
+                const unsigned int j = jb->cand[q];
+                if(j < 3 || c[j].color == -1 || j == tb->active_coin){continue;}
+                if(collidePair(tb, i, j) == 1)
+                {
+                    jb->hits++;
+                    if(bpDrift(tb, j, tb->bp_half) == 1)
+                        tb->bp_moved[j] = 1;
+                }
+            }
+        }
+    }
+#ifdef PHYS_STATS
+    statsAdd(&jb->stats, &phys_stats);
+    memset(&phys_stats, 0, sizeof(physstats));
+#endif
+}
+
+void* solverWorker(void* arg)
+{
+    solverjob* jb = arg;
+    for(;;)
+    {
+        pthread_barrier_wait(&solver.start);
+        solveRows(solver.tb, solver.pass, jb);
+        pthread_barrier_wait(&solver.done);
+    }
+    return NULL;
+}
+
+// starts threads-1 workers, the calling thread is worker 0,
+// returns 0 and stays single threaded if they can not be started
+int solverInit(const int threads)
+{
+    if(threads < 1 || threads > SOLVER_MAX_THREADS)
+        return 0;
+    if(pthread_barrier_init(&solver.start, NULL, threads) != 0)
+        return 0;
+    if(pthread_barrier_init(&solver.done, NULL, threads) != 0)
+    {
+        pthread_barrier_destroy(&solver.start);
+        return 0;
+    }
+    solver.threads = threads;
+    for(int t=0; t < threads; t++)
+        solver.job[t].id = t;
+    for(int t=1; t < threads; t++)
+    {
+        pthread_t th;
+        if(pthread_create(&th, NULL, solverWorker, &solver.job[t]) != 0)
+        {
+            // workers already started are parked on the start barrier
+            // for good, the barrier count is wrong so go single threaded
+            printf("WARNING: solver thread %i failed to start\n", t);
+            solver.threads = 0;
+            return 0;
+        }
+        pthread_detach(th);
+    }
+    return 1;
+}
+
+// threaded = 0 runs every worker's share of each pass on the calling
+// thread, the fuzzer's reference for it
+uint stepCollisionsStrips(table* tb, const int threaded)
+{
+    coin* c = tb->coins;
+    uint was_collision = 0;
+
+    // trophy pairs
+    memset(tb->bp_moved, 0, tb->num_coins * sizeof(uint));
+    for(unsigned int i=0; i < tb->num_coins; i++)
+    {
+        if(c[i].color == -1){continue;}
+        if(i < 3)
+        {
+            const int nc = bpGather(tb, i, tb->bp_cand);
+            if(tb->bp_audit == 1)
+                bpAudit(tb, i, tb->bp_cand, nc, NULL, &tb->bp_missed);
+            for(int p=0; p < nc; p++)
+            {
+                const unsigned int j = tb->bp_cand[p];
+                if(c[j].color == -1 || j == tb->active_coin){continue;}
+                was_collision += collidePair(tb, i, j);
+            }
+        }
+        else
+        {
+            for(unsigned int j=0; j < 3; j++)
+            {
+                if(c[j].color == -1 || j == tb->active_coin){continue;}
+                was_collision += collidePair(tb, i, j);
+            }
+        }
+    }
+
+    // pitch pairs, on the grid stepCollisions() built
+    for(unsigned int i=3; i < tb->num_coins; i++)
+        if(c[i].color != -1 && bpDrift(tb, i, tb->bp_half) == 1)
+            tb->bp_moved[i] = 1;
+    for(int t=0; t < solver.threads; t++)
+    {
+        solverjob* jb = &solver.job[t];
+        if(jb->cand_max < tb->max_coins)
+        {
+            int* nc = realloc(jb->cand, tb->max_coins * sizeof(int));
+            if(nc == NULL){return was_collision;}
+            jb->cand = nc;
+            jb->cand_max = tb->max_coins;
+        }
+        jb->hits = 0;
+        jb->missed = 0;
+        PSTAT(memset(&jb->stats, 0, sizeof(physstats)));
+    }
+    tb->par = 1;
+    solver.tb = tb;
+    for(int pass=0; pass < 3; pass++)
+    {
+        if(threaded == 1)
+        {
+            solver.pass = pass;
+            pthread_barrier_wait(&solver.start);
+            solveRows(tb, pass, &solver.job[0]);
+            pthread_barrier_wait(&solver.done);
+        }
+        else
+        {
+            for(int t=0; t < solver.threads; t++)
+                solveRows(tb, pass, &solver.job[t]);
+        }
+    }
+    tb->par = 0;
+    for(int t=0; t < solver.threads; t++)
+    {
+        was_collision += solver.job[t].hits;
+        tb->bp_missed += solver.job[t].missed;
+    }
+#ifdef PHYS_STATS
+    for(int t=0; t < solver.threads; t++)
+        statsAdd(&phys_stats, &solver.job[t].stats);
+#endif
+
+    // queue the leavers
+    for(unsigned int j=3; j < tb->num_coins; j++)
+    {
+        if(tb->left[j].kind != 0xff)
+        {
+            tb->events[tb->num_events++] = tb->left[j];
+            tb->left[j].kind = 0xff;
+        }
+    }
+
+    // settle the marked coins on a grid the index order solver keeps fresh
+    if(tb->bp_dirty == 1 || bpStale(tb, tb->bp_slack) == 1)
+        bpBuild(tb);
+    for(unsigned int i=3; i < tb->num_coins; i++)
+    {
+        if(tb->bp_moved[i] == 0){continue;}
+        tb->bp_moved[i] = 0;
+        if(c[i].color == -1){continue;}
+        if(tb->bp_dirty == 1)
+            bpBuild(tb);
+        const int nc = bpGather(tb, i, tb->bp_cand);
+        if(tb->bp_audit == 1)
+            bpAudit(tb, i, tb->bp_cand, nc, NULL, &tb->bp_missed);
+        for(int p=0; p < nc && c[i].color != -1; p++)
+        {
+            const unsigned int j = tb->bp_cand[p];
+            if(j < 3 || c[j].color == -1){continue;}
+            if(j != tb->active_coin)
+                was_collision += collidePair(tb, i, j);
+            if(i != tb->active_coin && c[j].color != -1)
+                was_collision += collidePair(tb, j, i);
+        }
+    }
+    return was_collision;
+}
+
+// every pair in coin index order, the single threaded solver
+uint solvePairs(table* tb)
+{
+    uint was_collision = 0;
+    for(unsigned int i=0; i < tb->num_coins; i++)
+    {
+        if(tb->coins[i].color == -1){continue;}
+        if(tb->bp_dirty == 1)
+            bpBuild(tb);
+        const int nc = bpGather(tb, i, tb->bp_cand);
+        if(tb->bp_audit == 1)
+            bpAudit(tb, i, tb->bp_cand, nc, NULL, &tb->bp_missed);
+        for(int p=0; p < nc; p++)
+        {
+            const unsigned int j = tb->bp_cand[p];
+            if(tb->coins[j].color == -1 || j == tb->active_coin){continue;}
+            was_collision += collidePair(tb, i, j);
+        }
+    }
+    return was_collision;
+}
+
+uint stepCollisions(table* tb)
+{
+    tb->tick++;
+    PSTAT(memset(&phys_stats, 0, sizeof(physstats)));
+    if(tiers[tb->quality].rebuild == 1 || tb->bp_dirty == 1 || solver.threads > 0)
+        bpBuild(tb);
+    const uint was_collision = solver.threads > 0 ? stepCollisionsStrips(tb, 1) : solvePairs(tb);
+#ifdef PHYS_STATS
+    phys_stats.substeps = 1;
+    statsAdd(&tb->stats_frame, &phys_stats);
+#endif
+    return was_collision;
+}
+
+//*************************************
+// heatmap
+//*************************************
+forceinline unsigned int heatCell(const coin* c)
+{
+    int x = (int)((P2F(c->x) - BP_X0) * HEAT_RCELL);
+    int y = (int)((P2F(c->y) - BP_Y0) * HEAT_RCELL);
+    if(x < 0){x = 0;}else if(x >= HEAT_W){x = HEAT_W-1;}
+    if(y < 0){y = 0;}else if(y >= HEAT_H){y = HEAT_H-1;}
+    return y*HEAT_W + x;
+}
+
+void heatDwell(heatmap* h, const table* tb)
+{
+    for(unsigned int i=0; i < tb->num_coins; i++)
+        if(tb->coins[i].color != -1)
+            h->dwell[heatCell(&tb->coins[i])]++;
+    h->steps++;
+}
+
+void heatMerge(heatmap* h, const heatmap* o)
+{
+    for(unsigned int i=0; i < HEAT_W*HEAT_H; i++)
+    {
+        h->dwell[i] += o->dwell[i];
+        for(int k=0; k < 4; k++)
+            h->exits[k][i] += o->exits[k][i];
+    }
+    h->steps += o->steps;
+}
+
+// A name ending .csv gets one "x,y,dwell,lost,silver,gold,spill" line per
+// cell with x,y its centre. Anything else gets "TPHM", then u32 version,
+// u32 width, u32 height, f32 x0, f32 y0, f32 cell size and u64 steps,
+// followed by the dwell grid and the four exit grids as u32 rows from y0
+// upwards. All little endian, written field by field.
+int heatSave(const heatmap* h, const char* fname)
+{
+    FILE* f = fopen(fname, "wb");
+    if(f == NULL)
+        return 0;
+    const size_t l = strlen(fname);
+    if(l > 4 && strcmp(&fname[l-4], ".csv") == 0)
+    {
+        fprintf(f, "x,y,dwell,lost,silver,gold,spill\n");
+        for(unsigned int i=0; i < HEAT_W*HEAT_H; i++)
+        {
+            fprintf(f, "%.2f,%.2f,%u,%u,%u,%u,%u\n",
+                BP_X0 + ((f32)(i % HEAT_W) + 0.5f) / HEAT_RCELL,
+                BP_Y0 + ((f32)(i / HEAT_W) + 0.5f) / HEAT_RCELL,
+                h->dwell[i], h->exits[SCORE_LOST][i], h->exits[SCORE_SILVER][i],
+                h->exits[SCORE_GOLD][i], h->exits[SCORE_SPILL][i]);
+        }
+    }
+    else
+    {
+        const unsigned int hdr[3] = {1, HEAT_W, HEAT_H};
+        const f32 geo[3] = {BP_X0, BP_Y0, 1.f / HEAT_RCELL};
+        const unsigned int steps[2] = {h->steps, h->steps >> 32};
+        fwrite("TPHM", 4, 1, f);
+        for(int i=0; i < 3; i++)
+            fputLE32(f, &hdr[i]);
+        for(int i=0; i < 3; i++)
+            fputLE32(f, &geo[i]);
+        fputLE32(f, &steps[0]);
+        fputLE32(f, &steps[1]);
+        for(unsigned int i=0; i < HEAT_W*HEAT_H; i++)
+            fputLE32(f, &h->dwell[i]);
+        for(int k=0; k < 4; k++)
+            for(unsigned int i=0; i < HEAT_W*HEAT_H; i++)
+                fputLE32(f, &h->exits[k][i]);
+    }
+    // a failed write can leave nothing for fclose() to fail on
+    const int ok = ferror(f) == 0;
+    return fclose(f) == 0 && ok == 1;
+}
+
+// pays out the coins that left the pitch, a coin is worth its colour + 1,
+// a trophy collects on its first visit and pays 6 of each after that
+void scoreEvents(table* tb)
+{
+    for(unsigned int k=0; k < tb->num_events; k++)
+    {
+        const scoreev* e = &tb->events[k];
+        if(tb->heat != NULL)
+            tb->heat->exits[e->kind][heatCell(&tb->coins[e->coin])]++;
+        if(e->kind == SCORE_LOST)
+            continue;
+        if(e->coin < 3)
+        {
+            if(trophies_get(tb, e->color-1)) // already have? then reward coins!
+            {
+                tb->gold_stack += 6.f;
+                tb->silver_stack += 6.f;
+            }
+            else
+                trophies_set(tb, e->color-1);
+        }
+        else if(e->kind == SCORE_GOLD)
+            tb->gold_stack += (f32)(e->color+1);
+        else if(e->kind == SCORE_SILVER)
+            tb->silver_stack += (f32)(e->color+1);
+        else
+            tb->silver_stack += 1.f;
+    }
+}
+
+// moves the coin in motion forward by dy and resolves the pitch
+void stepTable(table* tb, const f32 dy)
+{
+    tb->num_events = 0;
+    tb->num_moves = 0;
+    PSTAT(memset(&tb->stats_frame, 0, sizeof(physstats)));
+    if(tb->inmotion == 0)
+        return;
+
+    coin* a = &tb->coins[tb->active_coin];
+    if(a->y < F2P(-3.73414f))
+    {
+        // lower tiers bank the push and take it all in one step
+        const tier* q = &tiers[tb->quality];
+        tb->push += F2P(dy);
+        if(++tb->push_ticks < q->every)
+            return;
+        a->y += tb->push;
+        tb->push = 0;
+        tb->push_ticks = 0;
+        if(tb->quality != QUALITY_FOCUS)
+            tb->coarse = 1;
+
+        // the pusher moves the coin without going through collidePair()
+        if(q->rebuild == 0 && tb->active_coin >= 3)
+        {
+            const cacc my = (cacc)a->y - tb->bp_pos[tb->active_coin*2+1];
+            if(my > tb->bp_slack || my < -tb->bp_slack)
+                tb->bp_dirty = 1;
+        }
+
+        for(uint i=0; i < q->substeps; i++)
+            stepCollisions(tb);
+        if(tb->heat != NULL)
+            heatDwell(tb->heat, tb);
+        scoreEvents(tb);
+        tableCompact(tb);
+    }
+    else
+    {
+        tb->inmotion = 0;
+
+        // settle coarse pushes at the focus tier
+        if(tb->coarse == 1)
+        {
+            const uint q = tb->quality;
+            tb->quality = QUALITY_FOCUS;
+            for(uint i=0; i < QUALITY_SETTLE*tiers[QUALITY_FOCUS].substeps; i++)
+                stepCollisions(tb);
+            tb->quality = q;
+            tb->coarse = 0;
+            scoreEvents(tb);
+            tableCompact(tb);
+        }
+
+        if(tb->isnewcoin > 0)
+        {
+            if(tb->isnewcoin == 1)
+                tb->silver_stack -= 1.f;
+            else
+                tb->gold_stack -= 1.f;
+
+            tb->isnewcoin = 0;
+        }
+    }
+}
+
+//*************************************
+// differential fuzzer
+//*************************************
+
+// --fuzz plays random and adversarial boards through a reference solver
+// and every optimised solver this run has, then compares where every
+// coin ended up, which coins left the pitch and the stacks. The grid
+// index order solver is held to the brute force all pairs loop, the
+// strip solver is held to its own schedule run on one thread. The single
+// threaded run of each is also audited, every broadphase gather it makes
+// is checked against every coin so a pair the grid misses fails the case
+// even where both runs miss it alike. A failing board is shrunk one chunk
+// of coins at a time for as long as it keeps failing and the smallest one
+// is written out for --fuzz-case.
+// The reference and the solvers all push coins apart through the same
+// collidePair(), walls and goals, so the fuzzer checks which pairs are
+// found and the order they are solved in. It does not check the collision
+// response itself, a change to that passes as long as every solver has it.
+#define FUZZ_FRAMES 8
+#define FUZZ_EXTRA 256 // coins a board may have over the opening layout
+#ifdef FIXED_POINT
+    #define FUZZ_TOL 8 // 1/512 unit
+#else
+    #define FUZZ_TOL 0.002f
+#endif
+typedef struct
+{
+    coin* c;
+    unsigned int n, max;
+    unsigned int active;
+    unsigned int tick;
+    f32 dy;     // active coin travel each frame
+} fuzzcase;
+
+typedef struct
+{
+    const char* name;
+    uint (*step)(table* tb);
+    uint (*ref)(table* tb);
+    int audit_ref; // audit the gathers of ref rather than step, whichever is single threaded
+} fuzzsolver;
+
+uint fuzzBrute(table* tb)
+{
+    coin* c = tb->coins;
+    uint hits = 0;
+    tb->tick++;
+    for(unsigned int i=0; i < tb->num_coins; i++)
+    {
+        if(c[i].color == -1){continue;}
+        for(unsigned int j=0; j < tb->num_coins; j++)
+        {
+            if(j == i || c[j].color == -1 || j == tb->active_coin){continue;}
+            hits += collidePair(tb, i, j);
+        }
+    }
+    return hits;
+}
+uint fuzzPairs(table* tb){tb->tick++; bpBuild(tb); return solvePairs(tb);}
+uint fuzzStripsRef(table* tb){tb->tick++; bpBuild(tb); return stepCollisionsStrips(tb, 0);}
+uint fuzzStrips(table* tb){tb->tick++; bpBuild(tb); return stepCollisionsStrips(tb, 1);}
+
+// the solvers this run can use, returns how many
+int fuzzSolvers(fuzzsolver* fs)
+{
+    int n = 0;
+    fs[n++] = (fuzzsolver){"pairs", fuzzPairs, fuzzBrute, 0};
+    if(solver.threads > 0)
+        fs[n++] = (fuzzsolver){"strips", fuzzStrips, fuzzStripsRef, 1};
+    return n;
+}
+
+forceinline int fuzzAdd(fuzzcase* fc, const f32 x, const f32 y, const f32 r, const int color)
+{
+    if(fc->n == fc->max)
+        return -1;
+    fc->c[fc->n].x = F2P(x);
+    fc->c[fc->n].y = F2P(y);
+    fc->c[fc->n].r = F2P(r);
+    fc->c[fc->n].color = color;
+    return fc->n++;
+}
+
+// an opening layout roughed up one of four ways
+void fuzzBoard(fuzzcase* fc, const table* tb, unsigned int* seed)
+{
+    const f32 r = tb->coin_r;
+    fc->n = layoutPoisson(fc->c, 3 + tb->layout_coins, r, seed);
+    switch(xrandInt(seed, 0, 3))
+    {
+        case 0: // jostled so plenty overlap
+            for(unsigned int i=3; i < fc->n; i++)
+            {
+                fc->c[i].x += F2P(xrandFloat(seed, -r, r));
+                fc->c[i].y += F2P(xrandFloat(seed, -r, r));
+            }
+            break;
+        case 1: // dense clusters
+            for(int k = xrandInt(seed, 1, 3); k > 0; k--)
+            {
+                const f32 cx = xrandFloat(seed, pitch.x0, pitch.x1);
+                const f32 cy = xrandFloat(seed, pitch.y0, 4.4f);
+                for(int m = xrandInt(seed, 8, 64); m > 0; m--)
+                    fuzzAdd(fc, cx + xrandFloat(seed, -r*2.f, r*2.f), cy + xrandFloat(seed, -r*2.f, r*2.f), r, xrandInt(seed, 0, 1));
+            }
+            break;
+        case 2: // on the band boundaries and against the walls
+            for(int e=0; e < pitch.num_edges; e++)
+            {
+                const pedge* pe = &pitch.edge[e];
+                for(int m=0; m < 4; m++)
+                {
+                    const f32 y = P2F(pe->y0) + xrandFloat(seed, -0.002f, 0.002f);
+                    const f32 w = P2F(PWALL(pe->xr, pe->sr, pe->y0, F2P(y)));
+                    const f32 x = (m & 1 ? w : -w) + xrandFloat(seed, -r, r);
+                    fuzzAdd(fc, x, y, r, xrandInt(seed, 0, 1));
+                }
+            }
+            break;
+        case 3: // trophies by the goals
+            for(int i=0; i < 3; i++)
+            {
+                fc->c[i].x = F2P(xrandFloat(seed, -1.8f, 1.8f));
+                fc->c[i].y = F2P(xrandFloat(seed, 3.4f, 4.4f));
+                fc->c[i].r = F2P(TROPHY_R);
+                fc->c[i].color = xrandInt(seed, 1, 6);
+                for(int m = xrandInt(seed, 1, 6); m > 0; m--)
+                    fuzzAdd(fc, P2F(fc->c[i].x) + xrandFloat(seed, -0.8f, 0.8f), P2F(fc->c[i].y) - xrandFloat(seed, 0.f, 0.8f), r, xrandInt(seed, 0, 1));
+            }
+            break;
+    }
+
+    // and the coin being played
+    const int a = fuzzAdd(fc, xrandFloat(seed, -1.90433f, 1.90433f), -4.54055f + xrandFloat(seed, 0.f, 0.6f), r, xrandInt(seed, 0, 1));
+    fc->active = a < 0 ? fc->n-1 : (unsigned int)a;
+    fc->tick = xrand(seed);
+    fc->dy = xrandFloat(seed, 0.01f, 0.12f);
+}
+
+// loads the case into tb and plays FUZZ_FRAMES frames with step,
+// auditing its gathers into bp_missed if audit is 1
+int fuzzPlay(const fuzzcase* fc, uint (*step)(table* tb), table* tb, const uint audit)
+{
+    if(tableReserve(tb, fc->n) == 0)
+        return 0;
+    memcpy(tb->coins, fc->c, fc->n * sizeof(coin));
+    tb->num_coins = fc->n;
+    tb->active_coin = fc->active;
+    tb->tick = fc->tick;
+    tb->bp_audit = audit;
+    tb->bp_missed = 0;
+    tb->gold_stack = 64.f;
+    tb->silver_stack = 64.f;
+    trophies_clear(tb);
+    for(int f=0; f < FUZZ_FRAMES; f++)
+    {
+        tb->num_events = 0;
+        tb->coins[tb->active_coin].y += F2P(fc->dy);
+        for(int i=0; i < 6; i++)
+            step(tb);
+        scoreEvents(tb);
+    }
+    tb->bp_audit = 0;
+    return 1;
+}
+
+// returns 1 and says why in msg if a and b disagree
+int fuzzDiff(const table* a, const table* b, char* msg, const size_t len)
+{
+    if(a->gold_stack != b->gold_stack || a->silver_stack != b->silver_stack || a->trophies_bits != b->trophies_bits)
+    {
+        snprintf(msg, len, "stacks %g/%g/%i vs %g/%g/%i", a->gold_stack, a->silver_stack, a->trophies_bits, b->gold_stack, b->silver_stack, b->trophies_bits);
+        return 1;
+    }
+    for(unsigned int i=0; i < a->num_coins; i++)
+    {
+        const coin* p = &a->coins[i];
+        const coin* q = &b->coins[i];
+        const cacc dx = (cacc)p->x - q->x, dy = (cacc)p->y - q->y;
+        if(p->color != q->color || (p->color != -1 && (dx > FUZZ_TOL || dx < -FUZZ_TOL || dy > FUZZ_TOL || dy < -FUZZ_TOL)))
+        {
+            snprintf(msg, len, "slot %u %.4f,%.4f colour %i vs %.4f,%.4f colour %i", i, P2F(p->x), P2F(p->y), p->color, P2F(q->x), P2F(q->y), q->color);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int fuzzFails(const fuzzcase* fc, const fuzzsolver* fs, table* a, table* b, char* msg, const size_t len)
+{
+    if(fuzzPlay(fc, fs->ref, a, fs->audit_ref == 1) == 0 || fuzzPlay(fc, fs->step, b, fs->audit_ref == 0) == 0)
+        return 0;
+    const unsigned int missed = a->bp_missed + b->bp_missed;
+    if(missed > 0)
+    {
+        snprintf(msg, len, "broadphase missed %u touching pairs", missed);
+        return 1;
+    }
+    return fuzzDiff(a, b, msg, len);
+}
+
+// takes coins out of a failing case for as long as it still fails
+void fuzzShrink(fuzzcase* fc, const fuzzsolver* fs, table* a, table* b)
+{
+    char msg[256];
+    fuzzcase t = *fc;
+    t.c = malloc(fc->max * sizeof(coin));
+    if(t.c == NULL)
+        return;
+
+    for(unsigned int i=0; i < 3; i++)
+    {
+        if(fc->c[i].color == -1 || i == fc->active){continue;}
+        memcpy(t.c, fc->c, fc->n * sizeof(coin));
+        t.c[i].color = -1;
+        if(fuzzFails(&t, fs, a, b, msg, sizeof(msg)) == 1)
+            fc->c[i].color = -1;
+    }
+    for(unsigned int chunk = (fc->n-3)/2; chunk > 0; chunk /= 2)
+    {
+        unsigned int k = 3;
+        while(k + chunk <= fc->n)
+        {
+            if(fc->active >= k && fc->active < k+chunk)
+            {
+                k += chunk;
+                continue;
+            }
+            memcpy(t.c, fc->c, k * sizeof(coin));
+            memcpy(&t.c[k], &fc->c[k+chunk], (fc->n-k-chunk) * sizeof(coin));
+            t.n = fc->n - chunk;
+            t.active = fc->active > k ? fc->active - chunk : fc->active;
+            if(fuzzFails(&t, fs, a, b, msg, sizeof(msg)) == 1)
+            {
+                memcpy(fc->c, t.c, t.n * sizeof(coin));
+                fc->n = t.n;
+                fc->active = t.active;
+            }
+            else
+                k += chunk;
+        }
+    }
+    free(t.c);
+}
+
+// Case files are text, "tick", "dy" and "active" lines then one
+// "x y r colour" line per slot. Lines starting with # are ignored.
+int fuzzSave(const char* fname, const fuzzcase* fc, const char* comment)
+{
+    FILE* f = fopen(fname, "w");
+    if(f == NULL)
+        return 0;
+    fprintf(f, "# %s\ntick %u\ndy %.9g\nactive %u\n", comment, fc->tick, fc->dy, fc->active);
+    for(unsigned int i=0; i < fc->n; i++)
+        fprintf(f, "%.9g %.9g %.9g %i\n", P2F(fc->c[i].x), P2F(fc->c[i].y), P2F(fc->c[i].r), fc->c[i].color);
+    fclose(f);
+    return 1;
+}
+
+int fuzzLoad(const char* fname, fuzzcase* fc)
+{
+    FILE* f = fopen(fname, "r");
+    if(f == NULL)
+        return 0;
+    char line[256];
+    fc->n = 0;
+    while(fgets(line, sizeof(line), f) != NULL)
+    {
+        f32 x, y, r;
+        int color;
+        if(line[0] == '#'){continue;}
+        if(sscanf(line, "tick %u", &fc->tick) == 1){continue;}
+        if(sscanf(line, "dy %f", &fc->dy) == 1){continue;}
+        if(sscanf(line, "active %u", &fc->active) == 1){continue;}
+        if(sscanf(line, "%f %f %f %i", &x, &y, &r, &color) == 4 && fuzzAdd(fc, x, y, r, color) == -1)
+            break;
+    }
+    fclose(f);
+    return fc->n > 3 && fc->active < fc->n;
+}
+
+// fuzzes for the given seconds or replays one case file,
+// returns the number of failures
+int fuzzRun(const table* tb, const int seconds, const char* casefile)
+{
+    fuzzsolver fs[2];
+    const int ns = fuzzSolvers(fs);
+    table a, b;
+    fuzzcase fc = {0};
+    fc.max = 3 + tb->layout_coins + FUZZ_EXTRA;
+    fc.c = malloc(fc.max * sizeof(coin));
+    if(fc.c == NULL || tableInit(&a, tb->layout_coins, tb->coin_r) == 0 || tableInit(&b, tb->layout_coins, tb->coin_r) == 0)
+    {
+        printf("ERROR: fuzzRun(): out of memory\n");
+        return 1;
+    }
+
+    printf("Fuzzing");
+    for(int s=0; s < ns; s++)
+        printf(" %s", fs[s].name);
+    printf(", tolerance %g units\n", P2F(FUZZ_TOL));
+
+    char msg[256];
+    int fails = 0;
+    if(casefile != NULL)
+    {
+        if(fuzzLoad(casefile, &fc) == 0)
+        {
+            printf("ERROR: %s is not a fuzz case\n", casefile);
+            return 1;
+        }
+        for(int s=0; s < ns; s++)
+        {
+            if(fuzzFails(&fc, &fs[s], &a, &b, msg, sizeof(msg)) == 1)
+            {
+                printf("%s: FAIL %s\n", fs[s].name, msg);
+                fails++;
+            }
+            else
+                printf("%s: ok\n", fs[s].name);
+        }
+        return fails;
+    }
+
+    const time_t end = time(0) + seconds;
+    time_t report = time(0) + 10;
+    unsigned int seed = ((unsigned int)time(0) * 2654435761u) | 1;
+    unsigned long cases = 0;
+    while(time(0) < end)
+    {
+        const unsigned int cs = seed;
+        fuzzBoard(&fc, tb, &seed);
+        for(int s=0; s < ns; s++)
+        {
+            if(fuzzFails(&fc, &fs[s], &a, &b, msg, sizeof(msg)) == 0)
+                continue;
+            printf("FAIL %s seed %u: %s\n", fs[s].name, cs, msg);
+            fuzzShrink(&fc, &fs[s], &a, &b);
+            fuzzFails(&fc, &fs[s], &a, &b, msg, sizeof(msg));
+            char fname[64], comment[320];
+            snprintf(fname, sizeof(fname), "fuzz-%s-%u.txt", fs[s].name, cs);
+            snprintf(comment, sizeof(comment), "%s seed %u: %s", fs[s].name, cs, msg);
+            if(fuzzSave(fname, &fc, comment) == 1)
+                printf("  shrunk to %u slots: %s\n  wrote %s\n", fc.n, msg, fname);
+            fails++;
+            break;
+        }
+        cases++;
+        if(time(0) >= report)
+        {
+            char strts[16];
+            timestamp(&strts[0]);
+            printf("[%s] %lu cases, %i failures\n", strts, cases, fails);
+            report += 10;
+        }
+    }
+    printf("%lu cases, %i failures\n", cases, fails);
+    return fails;
+}
+
+//*************************************
+// opening layout bank
+//*************************************
+
+// A ring of ready made openings so newGame() only has to copy one in,
+// a low priority thread tops the ring back up in the background. The two
+// counting semaphores make it a plain single producer / single consumer
+// queue, newGame() never waits on it and makes its own layout if empty.
+#define LAYOUT_BANK 8
+coin* bank = NULL;            // bank_size layouts of bank_per coins each
+unsigned int* bank_n = NULL;  // used slots of each layout
+unsigned int bank_size = 0;
+unsigned int bank_per = 0;
+f32 bank_r = 0.3f;            // pitch coin radius the refill thread uses
+unsigned int bank_head = 0;   // next slot the refill thread writes
+unsigned int bank_tail = 0;   // next slot newGame() takes
+sem_t bank_free, bank_full;
+
+void* layoutRefill(void* arg)
+{
+    (void)arg;
+#ifdef SCHED_IDLE
+    const struct sched_param sp = {0};
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &sp);
+#endif
+    unsigned int seed = (((unsigned int)time(0) * 2654435761u) ^ 0x5bd1e995u) | 1;
+    for(;;)
+    {
+        sem_wait(&bank_free);
+        bank_n[bank_head] = layoutPoisson(&bank[bank_head*bank_per], bank_per, bank_r, &seed);
+        bank_head = (bank_head+1) % bank_size;
+        sem_post(&bank_full);
+    }
+    return NULL;
+}
+
+// returns 1 and copies the oldest banked layout into the table, or 0 if
+// the bank is empty or was never started
+int layoutTake(table* tb)
+{
+    if(bank == NULL || sem_trywait(&bank_full) != 0)
+        return 0;
+    const unsigned int n = bank_n[bank_tail];
+    if(tableReserve(tb, n) == 1)
+    {
+        memcpy(tb->coins, &bank[bank_tail*bank_per], n * sizeof(coin));
+        tb->num_coins = n;
+    }
+    bank_tail = (bank_tail+1) % bank_size;
+    sem_post(&bank_free);
+    return tb->num_coins == n;
+}
+
+// Layout files are "TPLB", then u32 version, u32 layout count and u32
+// coins per layout, followed by every coin as f32 x, y, r and s8 color.
+// All little endian, written field by field so there is no padding.
+// Returns 1, 0 if the file ends early or -1 if a coin is not one the game
+// could have made, the first 3 are trophies of color 1 to 6 and the rest
+// coins of color 0 or 1, either may be -1 for an unused slot, and every
+// used slot is inside the pitch.
+// The coins may be no bigger than coin_r or the broadphase misses pairs.
+int layoutRead(FILE* f, coin* l, const unsigned int per, const f32 coin_r)
+{
+    for(unsigned int i=0; i < per; i++)
+    {
+        f32 x, y, r;
+        if(fgetLE32(f, &x) == 0 || fgetLE32(f, &y) == 0 || fgetLE32(f, &r) == 0 ||
+           fread(&l[i].color, 1, 1, f) != 1)
+            return 0;
+        const int cmin = i < 3 ? 1 : 0, cmax = i < 3 ? 6 : 1;
+        if((l[i].color != -1 && (l[i].color < cmin || l[i].color > cmax)) ||
+           !(x >= BP_X0 && x <= BP_X1) || !(y >= BP_Y0 && y <= BP_Y1) ||
+           !(r > 0.f && F2P(r) <= F2P(i < 3 ? TROPHY_R : coin_r)))
+            return -1;
+        if(l[i].color != -1 && insidePitch(x, y, r) == 0)
+            return -1;
+        l[i].x = F2P(x);
+        l[i].y = F2P(y);
+        l[i].r = F2P(r);
+    }
+    return 1;
+}
+
+// loads whatever layouts fname holds (fname may be NULL) into the bank,
+// then starts the refill thread making layouts for the table
+void layoutBankInit(const table* tb, const char* fname)
+{
+    unsigned int count = 0, per = 0;
+    FILE* f = NULL;
+    if(fname != NULL)
+    {
+        f = fopen(fname, "rb");
+        char magic[4];
+        unsigned int ver;
+        if(f == NULL)
+            printf("WARNING: could not open layout file %s\n", fname);
+        else if(fread(magic, 4, 1, f) != 1 || memcmp(magic, "TPLB", 4) != 0 ||
+                fgetLE32(f, &ver) == 0 || ver != 1 ||
+                fgetLE32(f, &count) == 0 || fgetLE32(f, &per) == 0 || per < 3)
+        {
+            printf("WARNING: %s is not a layout file\n", fname);
+            count = 0;
+        }
+    }
+
+    bank_r = tb->coin_r;
+    bank_per = 3 + tb->layout_coins;
+    if(per > bank_per){bank_per = per;}
+    bank_size = count > LAYOUT_BANK ? count : LAYOUT_BANK;
+    bank = malloc(bank_size * bank_per * sizeof(coin));
+    bank_n = malloc(bank_size * sizeof(unsigned int));
+    if(bank == NULL || bank_n == NULL)
+    {
+        free(bank);
+        free(bank_n);
+        bank = NULL;
+        if(f != NULL){fclose(f);}
+        return;
+    }
+    for(unsigned int i=0; i < count; i++)
+    {
+        const int r = layoutRead(f, &bank[i*bank_per], per, tb->coin_r);
+        if(r == -1)
+        {
+            printf("WARNING: %s has a bad coin in layout %u, not loading it\n", fname, i);
+            count = 0;
+            break;
+        }
+        if(r == 0)
+        {
+            printf("WARNING: %s is truncated, loaded %u of %u layouts\n", fname, i, count);
+            count = i;
+            break;
+        }
+        bank_n[i] = per;
+    }
+    if(f != NULL){fclose(f);}
+
+    bank_head = count % bank_size;
+    bank_tail = 0;
+    sem_init(&bank_full, 0, count);
+    sem_init(&bank_free, 0, bank_size-count);
+
+    pthread_t th;
+    if(pthread_create(&th, NULL, layoutRefill, NULL) != 0)
+    {
+        printf("WARNING: layout refill thread failed to start\n");
+        return;
+    }
+    pthread_detach(th);
+}
+
+// generates count layouts for the table into fname for layoutBankInit()
+int layoutBankSave(const table* tb, const char* fname, const unsigned int count)
+{
+    const unsigned int per = 3 + tb->layout_coins;
+    coin* l = malloc(per * sizeof(coin));
+    FILE* f = fopen(fname, "wb");
+    if(f == NULL || l == NULL)
+    {
+        if(f != NULL){fclose(f);}
+        free(l);
+        return 0;
+    }
+    const unsigned int hdr[3] = {1, count, per};
+    fwrite("TPLB", 4, 1, f);
+    for(int i=0; i < 3; i++)
+        fputLE32(f, &hdr[i]);
+    unsigned int seed = ((unsigned int)time(0) * 2654435761u) | 1;
+    for(unsigned int i=0; i < count; i++)
+    {
+        const unsigned int n = layoutPoisson(l, per, tb->coin_r, &seed);
+        for(unsigned int j=0; j < 3; j++) // trophies that found no room
+        {
+            if(l[j].color != -1){continue;}
+            l[j].x = l[j].y = 0;
+            l[j].r = F2P(TROPHY_R);
+        }
+        for(unsigned int j=n; j < per; j++)
+        {
+            l[j].x = l[j].y = 0;
+            l[j].r = F2P(tb->coin_r);
+            l[j].color = -1;
+        }
+        for(unsigned int j=0; j < per; j++)
+        {
+            const f32 v[3] = {P2F(l[j].x), P2F(l[j].y), P2F(l[j].r)};
+            for(int k=0; k < 3; k++)
+                fputLE32(f, &v[k]);
+            fwrite(&l[j].color, 1, 1, f);
+        }
+    }
+    const int ok = ferror(f) == 0;
+    free(l);
+    return fclose(f) == 0 && ok == 1;
+}
+
+// refills the stacks and lays out a fresh pitch, taken from the layout
+// bank or made from rand(), or made from the stream seed when not NULL
+void tableReset(table* tb, unsigned int* seed)
+{
+    tb->gold_stack = 64.f;
+    tb->silver_stack = 64.f;
+    tb->active_coin = 0;
+    tb->inmotion = 0;
+    tb->isnewcoin = 0;
+    tb->num_events = 0;
+    tb->push = 0;
+    tb->push_ticks = 0;
+    tb->coarse = 0;
+    tb->bp_dirty = 1;
+    trophies_clear(tb);
+
+    // opening layout
+    if(seed != NULL || layoutTake(tb) == 0)
+    {
+        unsigned int rs;
+        if(seed == NULL){rs = rand() | 1; seed = &rs;}
+        tb->num_coins = 0;
+        if(tableReserve(tb, 3 + tb->layout_coins) == 1)
+            tb->num_coins = layoutPoisson(tb->coins, 3 + tb->layout_coins, tb->coin_r, seed);
+    }
+}
+
+void newGame()
+{
+    // seed randoms
+    srand(time(0));
+
+    // defaults
+    gameover = 0.f;
+    tableReset(&tbl, NULL);
+
+    rst = f32Time(); // round start time
+}
+
+//*************************************
+// simulation thread
+//*************************************
+
+// Only the simulation thread touches the table once the game is running,
+// it ticks at sim_hz and after every tick publishes a snapshot of what the
+// renderer needs through a triple buffer. The simulation fills its back
+// slot and swaps it for the middle slot in one atomic exchange, the
+// renderer swaps its front slot for the middle slot whenever a fresher
+// one is waiting there. Neither side ever waits on the other, the
+// renderer keeps drawing its front snapshot until a newer one turns up.
+// Input goes the other way through a small single producer / single
+// consumer ring of commands.
+// The renderer draws one tick behind, blending every coin from where it
+// was the tick before the newest snapshot to where it is in it by how far
+// the display clock has got into the tick, so the tick rate can be well
+// below the display rate and motion still comes out smooth.
+#define SIM_HZ 60
+#define SIM_FRESH 4 // set in sim_mid while the middle slot is unread
+typedef struct
+{
+    coin* coins;
+    coin* prev; // the same slots one tick earlier
+    unsigned int num_coins, max_coins;
+    f32 time;   // when it was published
+    f32 coin_r;
+    unsigned int active_coin;
+    uint inmotion;
+    f32 gold_stack;
+    f32 silver_stack;
+    char trophies_bits;
+    f32 gameover;   // game over time, 0 while playing
+    f32 rst;        // round start time
+} snapshot;
+snapshot snaps[3];
+_Atomic int sim_mid = 1;
+int sim_back = 2;   // simulation thread only
+int sim_front = 0;  // render thread only
+const snapshot* sn = &snaps[0]; // what the render thread is drawing
+f32 sim_speed = 1.6f; // PUSH_SPEED of the game being simulated
+unsigned int sim_hz = SIM_HZ;
+_Atomic uint sim_quality = QUALITY_FOCUS; // the renderer sets it from the window state
+
+#define SIM_DROP 0      // drop a coin at x
+#define SIM_NEWGAME 1   // start again at push speed x
+#define SIM_CMDS 16
+typedef struct
+{
+    int cmd;
+    f32 x;
+} simcmd;
+simcmd sim_cmd[SIM_CMDS];
+_Atomic unsigned int sim_cmd_head = 0, sim_cmd_tail = 0;
+
+// queues a command for the simulation, returns 0 if the ring is full
+int simSend(const int cmd, const f32 x)
+{
+    const unsigned int h = atomic_load_explicit(&sim_cmd_head, memory_order_relaxed);
+    if(h - atomic_load_explicit(&sim_cmd_tail, memory_order_acquire) == SIM_CMDS)
+        return 0;
+    sim_cmd[h % SIM_CMDS] = (simcmd){cmd, x};
+    atomic_store_explicit(&sim_cmd_head, h+1, memory_order_release);
+    return 1;
+}
+
+// sizes the back slot for the table, 0 if it couldn't grow
+int simReserve(snapshot* o)
+{
+    if(o->max_coins >= tbl.max_coins)
+        return 1;
+    coin* nc = realloc(o->coins, tbl.max_coins * sizeof(coin));
+    if(nc == NULL){return 0;}
+    o->coins = nc;
+    nc = realloc(o->prev, tbl.max_coins * sizeof(coin));
+    if(nc == NULL){return 0;}
+    o->prev = nc;
+    o->max_coins = tbl.max_coins;
+    return 1;
+}
+
+// notes where every coin is before the tick moves them
+void simCapture()
+{
+    snapshot* o = &snaps[sim_back];
+    if(simReserve(o) == 0)
+        return;
+    memcpy(o->prev, tbl.coins, tbl.num_coins * sizeof(coin));
+    o->num_coins = tbl.num_coins;
+}
+
+// copies the table into the back slot and hands it to the renderer
+void simPublish()
+{
+    snapshot* o = &snaps[sim_back];
+    if(simReserve(o) == 0)
+        return; // skip this one, the renderer keeps the last
+
+    // follow the coins tableCompact() moved, new slots start where they are
+    for(unsigned int i=0; i < tbl.num_moves; i += 2)
+        o->prev[tbl.moves[i+1]] = o->prev[tbl.moves[i]];
+    for(unsigned int i=o->num_coins; i < tbl.num_coins; i++)
+        o->prev[i] = tbl.coins[i];
+
+    memcpy(o->coins, tbl.coins, tbl.num_coins * sizeof(coin));
+    o->num_coins = tbl.num_coins;
+    o->time = f32Time();
+    o->coin_r = tbl.coin_r;
+    o->active_coin = tbl.active_coin;
+    o->inmotion = tbl.inmotion;
+    o->gold_stack = tbl.gold_stack;
+    o->silver_stack = tbl.silver_stack;
+    o->trophies_bits = tbl.trophies_bits;
+    o->gameover = gameover;
+    o->rst = rst;
+    sim_back = atomic_exchange(&sim_mid, sim_back | SIM_FRESH) & 3;
+}
+
+// the newest snapshot, only for the render thread
+const snapshot* simLatest()
+{
+    if(atomic_load_explicit(&sim_mid, memory_order_relaxed) & SIM_FRESH)
+        sim_front = atomic_exchange(&sim_mid, sim_front) & 3;
+    return &snaps[sim_front];
+}
+
+// where the render thread draws a coin, a of the way from p to c
+forceinline f32 simLerp(const cpos p, const cpos c, const f32 a)
+{
+    return P2F(p) + (P2F(c) - P2F(p)) * a;
+}
+
+// 1 once the game over screen has been up long enough for a click to start
+// a new game, and only the once per game over
+int newGameReady()
+{
+    static f32 sent = 0.f;
+    if(sn->gameover == 0.f || f32Time() <= sn->gameover+3.0f || sn->gameover == sent)
+        return 0;
+    sent = sn->gameover;
+    return 1;
+}
+
+void simTick()
+{
+    // commands
+    unsigned int tl = atomic_load_explicit(&sim_cmd_tail, memory_order_relaxed);
+    while(tl != atomic_load_explicit(&sim_cmd_head, memory_order_acquire))
+    {
+        const simcmd* c = &sim_cmd[tl % SIM_CMDS];
+        if(c->cmd == SIM_DROP && tbl.inmotion == 0 && gameover == 0.f)
+            takeStack(&tbl, c->x);
+        else if(c->cmd == SIM_NEWGAME)
+        {
+            sim_speed = c->x;
+            newGame();
+        }
+        atomic_store_explicit(&sim_cmd_tail, ++tl, memory_order_release);
+    }
+
+    // inject a new figure if time has come
+    injectFigure(&tbl, NULL);
+
+    // do motion
+    tbl.quality = atomic_load_explicit(&sim_quality, memory_order_relaxed);
+    simCapture();
+    stepTable(&tbl, sim_speed / (f32)sim_hz);
+
+    // detect gameover
+    if(tbl.gold_stack < 0.f){tbl.gold_stack = 0.f;}
+    if(tbl.silver_stack < 0.f){tbl.silver_stack = 0.f;}
+    if(gameover > 0.f && (tbl.gold_stack != 0.f || tbl.silver_stack != 0.f))
+    {
+        gameover = 0.f;
+    }
+    else if(tbl.gold_stack == 0.f && tbl.silver_stack == 0.f)
+    {
+        if(gameover == 0.f)
+            gameover = f32Time()+3.0f;
+    }
+
+    simPublish();
+}
+
+void* simThread(void* arg)
+{
+    (void)arg;
+    const double tick = 1.0/sim_hz;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    double next = now.tv_sec + now.tv_nsec*1e-9;
+    for(;;)
+    {
+        simTick();
+
+        // sleep off the rest of the tick, or skip ahead if we fell badly behind
+        next += tick;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        const double left = next - (now.tv_sec + now.tv_nsec*1e-9);
+        if(left > 0.0)
+        {
+            const struct timespec ts = {(time_t)left, (long)((left - (time_t)left) * 1e9)};
+            nanosleep(&ts, NULL);
+        }
+        else if(left < -0.25)
+            next -= left;
+    }
+    return NULL;
+}
+
+// publishes the opening snapshot and starts ticking
+int simStart()
+{
+    sim_speed = PUSH_SPEED;
+    tbl.num_moves = 0;
+    simCapture();
+    simPublish();
+    pthread_t th;
+    if(pthread_create(&th, NULL, simThread, NULL) != 0)
+        return 0;
+    pthread_detach(th);
+    return 1;
+}
+
+//*************************************
+// quantile sketch
+//*************************************
+
+// Log bucketed histogram of non negative counts, every value lands in the
+// bucket [g^(i-1), g^i) so any quantile it gives back is within 2% of the
+// true one. Fixed size and two of them merge by adding, so each batch
+// thread keeps its own and nothing ever has to hold every sample.
+#define SKETCH_BINS 1024 // covers up to g^1024, about 1.5e17
+#define SKETCH_G 1.04081632653f // (1+0.02)/(1-0.02)
+typedef struct
+{
+    unsigned long long bins[SKETCH_BINS];
+    unsigned long long zeros;
+    unsigned long long n;
+    double sum;
+    unsigned long long max;
+} sketch;
+
+void sketchAdd(sketch* k, const unsigned long long v)
+{
+    k->n++;
+    k->sum += (double)v;
+    if(v > k->max){k->max = v;}
+    if(v == 0)
+    {
+        k->zeros++;
+        return;
+    }
+    int i = (int)ceilf(logf((f32)v) / logf(SKETCH_G));
+    if(i >= SKETCH_BINS){i = SKETCH_BINS-1;}
+    k->bins[i]++;
+}
+
+void sketchMerge(sketch* k, const sketch* o)
+{
+    for(int i=0; i < SKETCH_BINS; i++)
+        k->bins[i] += o->bins[i];
+    k->zeros += o->zeros;
+    k->n += o->n;
+    k->sum += o->sum;
+    if(o->max > k->max){k->max = o->max;}
+}
+
+// the value at quantile q (0 to 1), 0 when the sketch is empty
+f32 sketchQuantile(const sketch* k, const f32 q)
+{
+    const unsigned long long r = (unsigned long long)(q * (f32)(k->n > 0 ? k->n-1 : 0));
+    unsigned long long c = k->zeros;
+    if(r < c)
+        return 0.f;
+    for(int i=0; i < SKETCH_BINS; i++)
+    {
+        c += k->bins[i];
+        if(r < c) // middle of the bucket
+            return 2.f * powf(SKETCH_G, (f32)i) / (SKETCH_G + 1.f);
+    }
+    return (f32)k->max;
+}
+
+void sketchPrint(const char* name, const sketch* k)
+{
+    printf("%-23s mean %8.2f  p10 %7.0f  p50 %7.0f  p90 %7.0f  p99 %7.0f  max %7llu\n", name,
+        k->n > 0 ? k->sum / (double)k->n : 0.0, sketchQuantile(k, 0.1f), sketchQuantile(k, 0.5f),
+        sketchQuantile(k, 0.9f), sketchQuantile(k, 0.99f), k->max);
+}
+
+//*************************************
+// batch simulation
+//*************************************
+
+// --simulate plays whole games headless as fast as it can, dropping every
+// coin at a random x. The games are shared out over --threads threads with
+// a table of their own each, so the strip solver isn't started and every
+// table runs the index order solver.
+// Every game draws its layout, figures and drops from a stream seeded by
+// --seed and the game's number alone, and starts its tick count from 0,
+// so a game plays out the same whichever thread it lands on.
+// A drop covers the coin falling and settling, then the figure that
+// replaces any captured trophy being pushed in. Every drop and game goes
+// into the sketches and, with --records, is written out as a CSV line of
+// kind,game,drop,x,coin,coins_in,coins_out,trophies,ticks
+// with game lines leaving x and coin empty. A game's lines are held until
+// every game before it has been written, so the file is in game order and
+// the same for a seed whatever the thread count.
+#define BATCH_MAX_DROPS 100000 // a game still going after this many is called off
+typedef struct
+{
+    table tb;
+    heatmap* heat;
+    unsigned int seed;          // stream of the game being played
+    unsigned long long steps;   // stepTable() calls so far
+    unsigned long long born[3]; // step each trophy was pushed in at
+    unsigned long long drops;
+
+    sketch drop_out;    // coins paid out per drop
+    sketch drop_ticks;  // steps for a drop to settle
+    sketch game_drops;  // drops a game lasts
+    sketch game_out;    // coins paid out per game
+    sketch game_ticks;  // steps a game lasts
+    sketch trophy_life; // steps a trophy is on the pitch before capture
+    unsigned long long trophies;
+#ifdef PHYS_STATS
+    physstats stats;
+    unsigned long long frames;
+#endif
+} batchjob;
+_Atomic unsigned int batch_next = 0; // games handed out so far
+unsigned int batch_games = 0;
+unsigned int batch_seed = 0;
+FILE* batch_records = NULL;
+typedef struct
+{
+    char* text;     // the game's records, NULL if they could not be kept
+    size_t len;
+    int done;
+} batchrec;
+batchrec* batch_rec = NULL;     // one per game, waiting to be written
+unsigned int batch_written = 0; // games written to batch_records so far
+pthread_mutex_t batch_rec_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// the stream seed for game g, well mixed so neighbouring games and seeds
+// do not start xrand() off alike
+forceinline unsigned int batchSeed(const unsigned int seed, const unsigned int g)
+{
+    unsigned int h = seed * 0x9E3779B1u ^ (g+1) * 0x85EBCA77u;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h | 1;
+}
+
+// hands over the records of game g and writes out every game that is
+// now next in line
+void batchRecords(const unsigned int g, char* text, const size_t len)
+{
+    pthread_mutex_lock(&batch_rec_lock);
+    batch_rec[g].text = text;
+    batch_rec[g].len = len;
+    batch_rec[g].done = 1;
+    for(; batch_written < batch_games && batch_rec[batch_written].done == 1; batch_written++)
+    {
+        batchrec* r = &batch_rec[batch_written];
+        if(r->text != NULL)
+            fwrite(r->text, 1, r->len, batch_records);
+        free(r->text);
+        r->text = NULL;
+    }
+    pthread_mutex_unlock(&batch_rec_lock);
+}
+
+// pushes the coin in motion until it has come to rest, returns the steps
+// it took and adds the trophies it captured to *trophies
+unsigned int batchSettle(batchjob* jb, unsigned int* trophies)
+{
+    table* tb = &jb->tb;
+    unsigned int ticks = 0;
+    while(tb->inmotion != 0)
+    {
+        stepTable(tb, PUSH_SPEED / (f32)SIM_HZ);
+        jb->steps++;
+        ticks++;
+#ifdef PHYS_STATS
+        if(tb->stats_frame.substeps > 0)
+        {
+            statsAdd(&jb->stats, &tb->stats_frame);
+            jb->frames++;
+        }
+#endif
+        for(unsigned int k=0; k < tb->num_events; k++)
+        {
+            const scoreev* e = &tb->events[k];
+            if(e->coin < 3 && e->kind != SCORE_LOST)
+            {
+                sketchAdd(&jb->trophy_life, jb->steps - jb->born[e->coin]);
+                (*trophies)++;
+            }
+        }
+    }
+    return ticks;
+}
+
+// pushes in a figure if a trophy slot is free and settles it
+unsigned int batchFigure(batchjob* jb, unsigned int* trophies)
+{
+    table* tb = &jb->tb;
+    injectFigure(tb, &jb->seed);
+    if(tb->inmotion != 0 && tb->active_coin < 3)
+        jb->born[tb->active_coin] = jb->steps;
+    return batchSettle(jb, trophies);
+}
+
+void* batchWorker(void* arg)
+{
+    batchjob* jb = arg;
+    table* tb = &jb->tb;
+    tb->heat = jb->heat;
+    unsigned int g;
+    while((g = atomic_fetch_add(&batch_next, 1)) < batch_games)
+    {
+        jb->seed = batchSeed(batch_seed, g);
+        tb->tick = 0;
+        tableReset(tb, &jb->seed);
+        char* text = NULL;
+        size_t len = 0;
+        FILE* rec = batch_records != NULL ? open_memstream(&text, &len) : NULL;
+        if(batch_records != NULL && rec == NULL)
+            printf("WARNING: out of memory, the records of game %u are lost\n", g);
+        for(int i=0; i < 3; i++)
+            jb->born[i] = jb->steps;
+        unsigned int gt = 0, gtr = 0, d = 0;
+        gt += batchFigure(jb, &gtr);
+        f32 out = 0.f;
+        for(; d < BATCH_MAX_DROPS; d++)
+        {
+            if(tb->gold_stack <= 0.f && tb->silver_stack <= 0.f)
+                break;
+            const f32 was = tb->gold_stack + tb->silver_stack;
+            const f32 x = xrandFloat(&jb->seed, -1.90433f, 1.90433f);
+            const int gold = tb->silver_stack == 0.f;
+            unsigned int tr = 0;
+            takeStack(tb, x);
+            unsigned int ticks = batchSettle(jb, &tr);
+            ticks += batchFigure(jb, &tr);
+            const f32 dout = tb->gold_stack + tb->silver_stack - was + 1.f;
+            sketchAdd(&jb->drop_out, (unsigned long long)dout);
+            sketchAdd(&jb->drop_ticks, ticks);
+            if(rec != NULL)
+                fprintf(rec, "drop,%u,%u,%.4f,%s,1,%.0f,%u,%u\n", g, d, x, gold ? "gold" : "silver", dout, tr, ticks);
+            out += dout;
+            gt += ticks;
+            gtr += tr;
+        }
+        sketchAdd(&jb->game_drops, d);
+        sketchAdd(&jb->game_out, (unsigned long long)out);
+        sketchAdd(&jb->game_ticks, gt);
+        if(rec != NULL)
+        {
+            fprintf(rec, "game,%u,%u,,,%u,%.0f,%u,%u\n", g, d, d, out, gtr, gt);
+            if(fclose(rec) != 0)
+            {
+                printf("WARNING: out of memory, the records of game %u are lost\n", g);
+                free(text);
+                text = NULL;
+            }
+        }
+        if(batch_records != NULL)
+            batchRecords(g, text, len);
+        jb->drops += d;
+        jb->trophies += gtr;
+    }
+    return NULL;
+}
+
+int batchRun(const table* tb, const unsigned int games, int threads, const unsigned int seed, const char* heatfile, const char* recfile)
+{
+    int ret = 1;
+    if(threads < 1){threads = 1;}
+    batchjob* jb = calloc(threads, sizeof(batchjob));
+    heatmap* heat = heatfile != NULL ? calloc(threads, sizeof(heatmap)) : NULL;
+    pthread_t* th = malloc(threads * sizeof(pthread_t));
+    if(jb == NULL || th == NULL || (heatfile != NULL && heat == NULL))
+    {
+        printf("ERROR: batchRun(): out of memory\n");
+        goto done;
+    }
+    for(int t=0; t < threads; t++)
+    {
+        if(tableInit(&jb[t].tb, tb->layout_coins, tb->coin_r) == 0)
+        {
+            printf("ERROR: batchRun(): out of memory\n");
+            goto done;
+        }
+        jb[t].heat = heat != NULL ? &heat[t] : NULL;
+    }
+    if(recfile != NULL)
+    {
+        batch_rec = calloc(games > 0 ? games : 1, sizeof(batchrec));
+        batch_written = 0;
+        if(batch_rec == NULL)
+        {
+            printf("ERROR: batchRun(): out of memory\n");
+            goto done;
+        }
+        batch_records = fopen(recfile, "w");
+        if(batch_records == NULL)
+        {
+            printf("ERROR: could not write %s\n", recfile);
+            goto done;
+        }
+        fprintf(batch_records, "kind,game,drop,x,coin,coins_in,coins_out,trophies,ticks\n");
+    }
+
+    printf("Simulating %u games on %i threads, seed %u\n", games, threads, seed);
+    struct timespec ts, te;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    batch_games = games;
+    batch_seed = seed;
+    batch_next = 0;
+    int started = 1;
+    for(; started < threads; started++) // the calling thread is the first
+        if(pthread_create(&th[started], NULL, batchWorker, &jb[started]) != 0)
+            break;
+    if(started < threads)
+        printf("WARNING: only %i of %i batch threads started\n", started, threads);
+    batchWorker(&jb[0]);
+    for(int t=1; t < started; t++)
+        pthread_join(th[t], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &te);
+
+    for(int t=1; t < threads; t++)
+    {
+        jb[0].drops += jb[t].drops;
+        jb[0].trophies += jb[t].trophies;
+        sketchMerge(&jb[0].drop_out, &jb[t].drop_out);
+        sketchMerge(&jb[0].drop_ticks, &jb[t].drop_ticks);
+        sketchMerge(&jb[0].game_drops, &jb[t].game_drops);
+        sketchMerge(&jb[0].game_out, &jb[t].game_out);
+        sketchMerge(&jb[0].game_ticks, &jb[t].game_ticks);
+        sketchMerge(&jb[0].trophy_life, &jb[t].trophy_life);
+#ifdef PHYS_STATS
+        statsAdd(&jb[0].stats, &jb[t].stats);
+        jb[0].frames += jb[t].frames;
+#endif
+    }
+    const batchjob* r = &jb[0];
+    const double secs = (te.tv_sec - ts.tv_sec) + (te.tv_nsec - ts.tv_nsec) * 1e-9;
+    printf("%u games, %llu drops, %llu trophies captured, %.1f seconds\n\n", games, r->drops, r->trophies, secs);
+    sketchPrint("drops a game", &r->game_drops);
+    sketchPrint("coins out a game", &r->game_out);
+    sketchPrint("steps a game", &r->game_ticks);
+    sketchPrint("coins out a drop", &r->drop_out);
+    sketchPrint("steps to settle a drop", &r->drop_ticks);
+    sketchPrint("steps to trophy capture", &r->trophy_life);
+    printf("\nDrops paying nothing: %.1f%%\n", r->drop_out.n > 0 ? 100.0 * r->drop_out.zeros / r->drop_out.n : 0.0);
+    if(r->drops > 0)
+        printf("Return to player: %.1f%%\n", 100.0 * r->drop_out.sum / (double)r->drops);
+#ifdef PHYS_STATS
+    printf("\n");
+    statsPrint(&r->stats, r->frames);
+#endif
+    if(batch_records != NULL)
+    {
+        const int ok = ferror(batch_records) == 0;
+        const int closed = fclose(batch_records);
+        batch_records = NULL;
+        if(closed != 0 || ok == 0)
+        {
+            printf("ERROR: could not write %s\n", recfile);
+            goto done;
+        }
+    }
+
+    if(heat != NULL)
+    {
+        for(int t=1; t < threads; t++)
+            heatMerge(&heat[0], &heat[t]);
+        if(heatSave(&heat[0], heatfile) == 0)
+        {
+            printf("ERROR: could not write %s\n", heatfile);
+            goto done;
+        }
+        printf("Wrote the heatmap to %s\n", heatfile);
+    }
+    ret = 0;
+
+done:
+    if(batch_records != NULL)
+    {
+        fclose(batch_records);
+        batch_records = NULL;
+    }
+    free(batch_rec);
+    batch_rec = NULL;
+    if(jb != NULL)
+        for(int t=0; t < threads; t++)
+            tableFree(&jb[t].tb);
+    free(jb);
+    free(heat);
+    free(th);
+    return ret;
+}
+
+//*************************************
+// GL state cache
+//*************************************
+
+// The render code sets state through these instead of GL so a call that
+// would not change anything is never made. gs mirrors the VAO, the array
+// and element buffer bindings, the enabled attribute arrays and the
+// capabilities, and gs_uniforms the uniforms of each program as csp. The
+// element binding and attribute arrays belong to the bound VAO so they
+// are forgotten when it changes. Anything that sets state behind its back
+// calls gsReset(). Build with -DGLSTATE_VERIFY to check the cache against
+// GL at the end of every rqFlush() and frame.
+#define GS_UNKNOWN 0xffffffff
+#define GS_UNIFORMS 32
+#ifdef BUILD_GLFW
+    PFNGLGENVERTEXARRAYSPROC vaoGen = NULL;
+    PFNGLBINDVERTEXARRAYPROC vaoBind = NULL;
+#else
+    PFNGLGENVERTEXARRAYSOESPROC vaoGen = NULL;
+    PFNGLBINDVERTEXARRAYOESPROC vaoBind = NULL;
+#endif
+
+struct
+{
+    GLuint vao;
+    GLuint array, element;
+    unsigned int attr_on, attr_known; // a bit per attribute array
+    signed char blend, depth, cull;   // -1 if unknown
+} gs;
+
+typedef struct
+{
+    int prog; // as csp
+    GLint loc;
+    int n;    // 1, 3 or 16 floats
+    f32 v[16];
+} gs_uniform;
+gs_uniform gs_uniforms[GS_UNIFORMS];
+unsigned int gs_num_uniforms = 0;
+
+void gsReset()
+{
+    gs.vao = gs.array = gs.element = GS_UNKNOWN;
+    gs.attr_on = gs.attr_known = 0;
+    gs.blend = gs.depth = gs.cull = -1;
+    gs_num_uniforms = 0;
+}
+
+forceinline void gsVao(const GLuint vao)
+{
+    if(vaoBind == NULL || vao == gs.vao){return;}
+    vaoBind(vao);
+    gs.vao = vao;
+    gs.element = GS_UNKNOWN;
+    gs.attr_known = 0;
+}
+
+forceinline void gsBuffer(const GLenum target, const GLuint id)
+{
+    GLuint* b = target == GL_ARRAY_BUFFER ? &gs.array : &gs.element;
+    if(*b == id){return;}
+    glBindBuffer(target, id);
+    *b = id;
+}
+
+forceinline void gsAttrib(const GLint id, const int on)
+{
+    if(id < 0){return;}
+    const unsigned int bit = 1u << id;
+    if((gs.attr_known & bit) != 0 && ((gs.attr_on & bit) != 0) == on){return;}
+    if(on == 1)
+        glEnableVertexAttribArray(id);
+    else
+        glDisableVertexAttribArray(id);
+    gs.attr_known |= bit;
+    gs.attr_on = on == 1 ? gs.attr_on | bit : gs.attr_on & ~bit;
+}
+
+forceinline void gsCap(const GLenum cap, const int on)
+{
+    signed char* c = cap == GL_BLEND ? &gs.blend : cap == GL_DEPTH_TEST ? &gs.depth : &gs.cull;
+    if(*c == on){return;}
+    if(on == 1)
+        glEnable(cap);
+    else
+        glDisable(cap);
+    *c = on;
+}
+
+// sets the n floats of uniform loc of the current program
+void gsUniform(const GLint loc, const int n, const f32* v)
+{
+    if(loc < 0){return;}
+    gs_uniform* u = NULL;
+    for(unsigned int i=0; i < gs_num_uniforms; i++)
+    {
+        if(gs_uniforms[i].prog == csp && gs_uniforms[i].loc == loc)
+        {
+            u = &gs_uniforms[i];
+            break;
+        }
+    }
+    if(u != NULL && memcmp(u->v, v, n * sizeof(f32)) == 0){return;}
+    if(n == 1)
+        glUniform1f(loc, v[0]);
+    else if(n == 3)
+        glUniform3fv(loc, 1, v);
+    else
+        glUniformMatrix4fv(loc, 1, GL_FALSE, v);
+    if(csp < 0){return;} // not a program we know
+    if(u == NULL && gs_num_uniforms < GS_UNIFORMS)
+        u = &gs_uniforms[gs_num_uniforms++];
+    if(u == NULL){return;}
+    u->prog = csp;
+    u->loc = loc;
+    u->n = n;
+    memcpy(u->v, v, n * sizeof(f32));
+}
+
+forceinline void gsUniform1f(const GLint loc, const f32 x)
+{
+    gsUniform(loc, 1, &x);
+}
+
+forceinline void gsUniform3f(const GLint loc, const f32 x, const f32 y, const f32 z)
+{
+    const f32 v[3] = {x, y, z};
+    gsUniform(loc, 3, v);
+}
+
+forceinline void gsUniformMatrix(const GLint loc, const mat* m)
+{
+    gsUniform(loc, 16, &m->m[0][0]);
+}
+
+#ifdef GLSTATE_VERIFY
+    #ifndef GL_VERTEX_ARRAY_BINDING
+        #define GL_VERTEX_ARRAY_BINDING 0x85B5
+    #endif
+    GLuint gsProgram(const int prog);
+
+    // prints every way GL differs from the cache
+    void gsVerify(const char* where)
+    {
+        GLint v;
+        if(vaoBind != NULL && gs.vao != GS_UNKNOWN)
+        {
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &v);
+            if((GLuint)v != gs.vao){printf("WARNING: %s: VAO %i, cached %u\n", where, v, gs.vao);}
+        }
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &v);
+        if(gs.array != GS_UNKNOWN && (GLuint)v != gs.array){printf("WARNING: %s: array buffer %i, cached %u\n", where, v, gs.array);}
+        glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &v);
+        if(gs.element != GS_UNKNOWN && (GLuint)v != gs.element){printf("WARNING: %s: element buffer %i, cached %u\n", where, v, gs.element);}
+        for(int i=0; i < 8; i++)
+        {
+            if((gs.attr_known & (1u << i)) == 0){continue;}
+            glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &v);
+            if((v != 0) != ((gs.attr_on >> i) & 1)){printf("WARNING: %s: attribute array %i is %i, cached %u\n", where, i, v, (gs.attr_on >> i) & 1);}
+        }
+        const GLenum cap[3] = {GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE};
+        const signed char on[3] = {gs.blend, gs.depth, gs.cull};
+        for(int i=0; i < 3; i++)
+            if(on[i] != -1 && glIsEnabled(cap[i]) != on[i]){printf("WARNING: %s: capability 0x%x is %i, cached %i\n", where, cap[i], !on[i], on[i]);}
+        if(csp >= 0)
+        {
+            glGetIntegerv(GL_CURRENT_PROGRAM, &v);
+            if((GLuint)v != gsProgram(csp)){printf("WARNING: %s: program %i, cached %u\n", where, v, gsProgram(csp));}
+        }
+        for(unsigned int i=0; i < gs_num_uniforms; i++)
+        {
+            const gs_uniform* u = &gs_uniforms[i];
+            f32 f[16];
+            glGetUniformfv(gsProgram(u->prog), u->loc, f);
+            if(memcmp(f, u->v, u->n * sizeof(f32)) != 0){printf("WARNING: %s: uniform %i of program %i differs from the cache\n", where, u->loc, u->prog);}
+        }
+    }
+    #define GSVERIFY(x) gsVerify(x)
+#else
+    #define GSVERIFY(x)
+#endif
+
+//*************************************
+// vertex format
+//*************************************
+
+// The lit models are one interleaved buffer of 20 byte vertices instead
+// of three f32 streams of 36 bytes, positions stay f32 but the normal is
+// normalised s8 and the colour normalised u8, each padded to 4 bytes.
+// The colour's fourth byte is 255 but on the coins holds the palette class.
+// vert_attribs describes the layout, position, normal then colour.
+typedef struct
+{
+    f32 p[3];
+    signed char n[4];
+    unsigned char c[4];
+} vert;
+
+typedef struct
+{
+    GLint size;
+    GLenum type;
+    GLboolean norm;
+    size_t offset;
+} vattrib;
+
+const vattrib vert_attribs[3] =
+{
+    {3, GL_FLOAT, GL_FALSE, offsetof(vert, p)},
+    {3, GL_BYTE, GL_TRUE, offsetof(vert, n)},
+    {4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(vert, c)}
+};
+
+// points the position, normal and colour attributes at the vert buffer
+// bound to GL_ARRAY_BUFFER, starting at vertex v
+forceinline void vertPointers(const GLint pos, const GLint nrm, const GLint col, const unsigned int v)
+{
+    const GLint id[3] = {pos, nrm, col};
+    for(int i=0; i < 3; i++)
+    {
+        glVertexAttribPointer(id[i], vert_attribs[i].size, vert_attribs[i].type, vert_attribs[i].norm, sizeof(vert), (void*)(v * sizeof(vert) + vert_attribs[i].offset));
+        gsAttrib(id[i], 1);
+    }
+}
+
+// normalises x,y,z into o as s8
+forceinline void packNormal(signed char* o, const f32 x, const f32 y, const f32 z)
+{
+    f32 l = sqrtf(x*x + y*y + z*z);
+    l = l > 0.f ? 127.f / l : 0.f;
+    o[0] = (signed char)lroundf(x*l);
+    o[1] = (signed char)lroundf(y*l);
+    o[2] = (signed char)lroundf(z*l);
+    o[3] = 0;
+}
+
+// packs the rgb at c into o as u8
+forceinline void packColor(unsigned char* o, const f32* c)
+{
+    for(int i=0; i < 3; i++)
+        o[i] = (unsigned char)lroundf((c[i] < 0.f ? 0.f : c[i] > 1.f ? 1.f : c[i]) * 255.f);
+    o[3] = 255;
+}
+
+// packs nv vertices of separate position, normal and colour arrays into o
+void vertPack(vert* o, const GLfloat* v, const GLfloat* n, const GLfloat* c, const unsigned int nv)
+{
+    for(unsigned int i=0; i < nv; i++)
+    {
+        o[i].p[0] = v[i*3];
+        o[i].p[1] = v[i*3+1];
+        o[i].p[2] = v[i*3+2];
+        packNormal(o[i].n, n[i*3], n[i*3+1], n[i*3+2]);
+        packColor(o[i].c, &c[i*3]);
+    }
+}
+//*************************************
+// mesh optimiser
+//*************************************
+
+// The models come out of the exporter with a vertex per triangle corner and
+// the triangles in export order. meshBind() welds the vertices that pack to
+// the same bytes, reorders the triangles for the post-transform cache with
+// Tom Forsyth's linear speed optimiser and then the vertices by first use
+// so fetches walk the buffer forwards. It runs at load so the assets stay
+// as exported. mesh_stats sums ACMR (cache misses per triangle, FIFO of
+// MESH_FIFO) and vertex counts over every model before and after.
+#define FORSYTH_CACHE 32
+#define MESH_FIFO 16
+
+typedef struct
+{
+    vert* v;
+    GLushort* i;
+    unsigned int nv, ni;
+} mesh;
+mesh meshCoin; // as bound, kept for the stacks and batched coins
+
+struct
+{
+    unsigned int tris, verts, welded;
+    unsigned int miss, opt_miss;
+} mesh_stats;
+
+// cache misses of drawing ni indices through a FIFO of MESH_FIFO
+unsigned int meshMisses(const unsigned int* idx, const unsigned int ni, const unsigned int nv)
+{
+    unsigned int* stamp = calloc(nv, sizeof(unsigned int));
+    if(stamp == NULL){return 0;}
+    unsigned int miss = 0;
+    for(unsigned int i=0; i < ni; i++)
+    {
+        if(stamp[idx[i]] == 0 || miss + 1 - stamp[idx[i]] > MESH_FIFO)
+            stamp[idx[i]] = ++miss;
+    }
+    free(stamp);
+    return miss;
+}
+
+// merges the vertices of nv records of stride bytes that are byte for
+// byte the same, remaps idx and returns the new vertex count
+unsigned int meshWeld(unsigned char* rec, const size_t stride, const unsigned int nv, unsigned int* idx, const unsigned int ni)
+{
+    unsigned int size = 1;
+    while(size < nv*2){size <<= 1;}
+    unsigned int* table = malloc(size * sizeof(unsigned int));
+    unsigned int* remap = malloc(nv * sizeof(unsigned int));
+    if(table == NULL || remap == NULL)
+    {
+        free(table);
+        free(remap);
+        return nv;
+    }
+    memset(table, 0xff, size * sizeof(unsigned int));
+    unsigned int n = 0;
+    for(unsigned int i=0; i < nv; i++)
+    {
+        const unsigned char* r = &rec[i*stride];
+        unsigned int h = 2166136261u;
+        for(size_t j=0; j < stride; j++)
+            h = (h ^ r[j]) * 16777619u;
+        h &= size-1;
+        while(table[h] != 0xffffffff && memcmp(&rec[table[h]*stride], r, stride) != 0)
+            h = (h+1) & (size-1);
+        if(table[h] == 0xffffffff)
+        {
+            memmove(&rec[n*stride], r, stride);
+            table[h] = n++;
+        }
+        remap[i] = table[h];
+    }
+    for(unsigned int i=0; i < ni; i++)
+        idx[i] = remap[idx[i]];
+    free(table);
+    free(remap);
+    return n;
+}
+
+forceinline f32 forsythScore(const int pos, const unsigned int remaining)
+{
+    if(remaining == 0){return -1.f;}
+    f32 s = 0.f;
+    if(pos >= 0)
+        s = pos < 3 ? 0.75f : powf(1.f - (pos-3) * (1.f / (FORSYTH_CACHE-3)), 1.5f);
+    return s + 2.f / sqrtf((f32)remaining);
+}
+
+// reorders the triangles of idx for the post-transform cache
+void meshForsyth(unsigned int* idx, const unsigned int ni, const unsigned int nv)
+{
+    const unsigned int nt = ni / 3;
+    unsigned int* start = calloc(nv+1, sizeof(unsigned int));
+    unsigned int* left = calloc(nv, sizeof(unsigned int));  // triangles not yet drawn per vertex
+    unsigned int* adj = malloc(ni * sizeof(unsigned int));  // triangles of each vertex, drawn ones removed
+    int* pos = malloc(nv * sizeof(int));                    // cache position or -1
+    f32* vs = malloc(nv * sizeof(f32));
+    f32* ts = malloc(nt * sizeof(f32));
+    unsigned char* done = calloc(nt, 1);
+    unsigned int* out = malloc(ni * sizeof(unsigned int));
+    if(start == NULL || left == NULL || adj == NULL || pos == NULL || vs == NULL || ts == NULL || done == NULL || out == NULL)
+        goto fail;
+
+    for(unsigned int i=0; i < ni; i++)
+        left[idx[i]]++;
+    for(unsigned int v=0; v < nv; v++)
+        start[v+1] = start[v] + left[v];
+    for(unsigned int i=0; i < ni; i++)
+        adj[start[idx[i]+1] - left[idx[i]]--] = i/3;
+    for(unsigned int v=0; v < nv; v++)
+    {
+        left[v] = start[v+1] - start[v];
+        pos[v] = -1;
+        vs[v] = forsythScore(-1, left[v]);
+    }
+    for(unsigned int t=0; t < nt; t++)
+        ts[t] = vs[idx[t*3]] + vs[idx[t*3+1]] + vs[idx[t*3+2]];
+
+    unsigned int cache[FORSYTH_CACHE+3];
+    unsigned int cn = 0, scan = 0;
+    int best = -1;
+    for(unsigned int o=0; o < nt; o++)
+    {
+        if(best < 0)
+        {
+            // nothing in the cache touches a triangle left, take the best of the rest
+            f32 bs = -1.f;
+            while(scan < nt && done[scan] == 1){scan++;}
+            for(unsigned int t=scan; t < nt; t++)
+                if(done[t] == 0 && ts[t] > bs){bs = ts[t]; best = t;}
+        }
+        done[best] = 1;
+        memcpy(&out[o*3], &idx[best*3], 3 * sizeof(unsigned int));
+
+        // drop it from its vertices and put them at the front of the cache
+        unsigned int nc[FORSYTH_CACHE+3];
+        unsigned int tn = 0;
+        for(int k=0; k < 3; k++)
+        {
+            const unsigned int v = idx[best*3+k];
+            for(unsigned int a=start[v]; a < start[v]+left[v]; a++)
+            {
+                if(adj[a] == (unsigned int)best)
+                {
+                    adj[a] = adj[start[v]+left[v]-1];
+                    left[v]--;
+                    break;
+                }
+            }
+            if((tn < 1 || nc[0] != v) && (tn < 2 || nc[1] != v))
+                nc[tn++] = v;
+        }
+        unsigned int nn = tn;
+        for(unsigned int c=0; c < cn; c++)
+            if(cache[c] != nc[0] && (tn < 2 || cache[c] != nc[1]) && (tn < 3 || cache[c] != nc[2]))
+                nc[nn++] = cache[c];
+
+        // rescore what moved or fell out, the best triangle of the cache is next
+        for(unsigned int c=0; c < nn; c++)
+        {
+            const unsigned int v = nc[c];
+            pos[v] = c < FORSYTH_CACHE ? (int)c : -1;
+            const f32 d = forsythScore(pos[v], left[v]) - vs[v];
+            vs[v] += d;
+            for(unsigned int a=start[v]; a < start[v]+left[v]; a++)
+                ts[adj[a]] += d;
+        }
+        best = -1;
+        f32 bs = -1.f;
+        for(unsigned int c=0; c < nn && c < FORSYTH_CACHE; c++)
+            for(unsigned int a=start[nc[c]]; a < start[nc[c]]+left[nc[c]]; a++)
+                if(ts[adj[a]] > bs){bs = ts[adj[a]]; best = adj[a];}
+        cn = nn < FORSYTH_CACHE ? nn : FORSYTH_CACHE;
+        memcpy(cache, nc, cn * sizeof(unsigned int));
+    }
+    memcpy(idx, out, nt * 3 * sizeof(unsigned int));
+
+fail:
+    free(start);
+    free(left);
+    free(adj);
+    free(pos);
+    free(vs);
+    free(ts);
+    free(done);
+    free(out);
+}
+
+// renumbers the vertices in the order idx first uses them
+void meshFetch(unsigned char* rec, const size_t stride, const unsigned int nv, unsigned int* idx, const unsigned int ni)
+{
+    unsigned int* remap = malloc(nv * sizeof(unsigned int));
+    unsigned char* tmp = malloc(nv * stride);
+    if(remap == NULL || tmp == NULL)
+    {
+        free(remap);
+        free(tmp);
+        return;
+    }
+    memset(remap, 0xff, nv * sizeof(unsigned int));
+    unsigned int n = 0;
+    for(unsigned int i=0; i < ni; i++)
+    {
+        if(remap[idx[i]] == 0xffffffff)
+        {
+            memcpy(&tmp[n*stride], &rec[idx[i]*stride], stride);
+            remap[idx[i]] = n++;
+        }
+        idx[i] = remap[idx[i]];
+    }
+    memcpy(rec, tmp, n * stride);
+    free(remap);
+    free(tmp);
+}
+
+//*************************************
+// levels of detail
+//*************************************
+
+// Tux and his accessories get LOD_LEVELS-1 coarser copies made at load by
+// clustering the vertices on a grid of lod_cell world units, one cluster
+// per cell and colour so the black, white and orange stay sharp, and
+// dropping the triangles that collapse. The levels are appended to the
+// model's own buffers so the VAO covers all of them and a level is just
+// a range of indices. lodPick() chooses by the size Tux projects to on
+// screen, lod_detail (--detail) pushes every pick coarser for low end
+// cabinets, and a pick only changes once the size is LOD_HYST past a
+// threshold so a figure sitting on one does not flicker between levels.
+#define LOD_LEVELS 3
+#define LOD_HYST 0.15f
+const f32 lod_cell[LOD_LEVELS] = {0.f, 0.04f, 0.08f};
+const f32 lod_px[LOD_LEVELS-1] = {64.f, 32.f}; // projected radius below which the next level is used
+int lod_detail = 0;
+int lod_state[9]; // last size based pick of each pitch figure and shelf trophy
+
+typedef struct
+{
+    GLsizei count[LOD_LEVELS]; // indices of each level
+    GLsizei first[LOD_LEVELS]; // first index of each level
+    f32 radius;                // of the model around its origin
+} lodchain;
+lodchain lodTux, lodEvil, lodKing, lodNinja, lodSurf, lodTrip;
+
+// clusters nv vertices onto a grid of cell, one vertex per cell and colour
+// at the mean of its members, into ov and oi, returns the vertex count and
+// sets *oni to the indices of the triangles that did not collapse
+unsigned int lodCluster(const vert* v, const unsigned int nv, const unsigned int* idx, const unsigned int ni, const f32 cell, vert* ov, unsigned int* oi, unsigned int* oni)
+{
+    unsigned int size = 1;
+    while(size < nv*2){size <<= 1;}
+    unsigned int* table = malloc(size * sizeof(unsigned int));
+    unsigned int* remap = malloc(nv * sizeof(unsigned int));
+    int* key = malloc(nv * 4 * sizeof(int));
+    f32* sum = calloc(nv * 7, sizeof(f32)); // position, normal, members
+    if(table == NULL || remap == NULL || key == NULL || sum == NULL)
+    {
+        free(table);
+        free(remap);
+        free(key);
+        free(sum);
+        *oni = 0;
+        return 0;
+    }
+    memset(table, 0xff, size * sizeof(unsigned int));
+    unsigned int n = 0;
+    for(unsigned int i=0; i < nv; i++)
+    {
+        int k[4];
+        for(int j=0; j < 3; j++)
+            k[j] = (int)floorf(v[i].p[j] / cell);
+        k[3] = v[i].c[0] | (v[i].c[1] << 8) | (v[i].c[2] << 16);
+        unsigned int h = 2166136261u;
+        for(int j=0; j < 4; j++)
+            h = (h ^ (unsigned int)k[j]) * 16777619u;
+        h &= size-1;
+        while(table[h] != 0xffffffff && memcmp(&key[table[h]*4], k, sizeof(k)) != 0)
+            h = (h+1) & (size-1);
+        if(table[h] == 0xffffffff)
+        {
+            memcpy(&key[n*4], k, sizeof(k));
+            memcpy(ov[n].c, v[i].c, 4);
+            table[h] = n++;
+        }
+        const unsigned int c = remap[i] = table[h];
+        for(int j=0; j < 3; j++)
+        {
+            sum[c*7+j] += v[i].p[j];
+            sum[c*7+3+j] += v[i].n[j] * (1.f/127.f);
+        }
+        sum[c*7+6] += 1.f;
+    }
+    for(unsigned int c=0; c < n; c++)
+    {
+        for(int j=0; j < 3; j++)
+            ov[c].p[j] = sum[c*7+j] / sum[c*7+6];
+        packNormal(ov[c].n, sum[c*7+3], sum[c*7+4], sum[c*7+5]);
+    }
+    unsigned int m = 0;
+    for(unsigned int i=0; i < ni; i += 3)
+    {
+        const unsigned int a = remap[idx[i]], b = remap[idx[i+1]], c = remap[idx[i+2]];
+        if(a == b || b == c || a == c){continue;}
+        oi[m++] = a;
+        oi[m++] = b;
+        oi[m++] = c;
+    }
+    *oni = m;
+    free(table);
+    free(remap);
+    free(key);
+    free(sum);
+    return n;
+}
+
+// appends the coarser levels of the nv vertex, ni index model in *rec and
+// *idx to them and fills lod in, returns the new index count
+unsigned int lodBuild(lodchain* lod, vert** rec, unsigned int* nv, unsigned int** idx, const unsigned int ni)
+{
+    lod->first[0] = 0;
+    lod->count[0] = ni;
+    lod->radius = 0.f;
+    for(unsigned int i=0; i < *nv; i++)
+    {
+        const f32* p = (*rec)[i].p;
+        const f32 r = sqrtf(p[0]*p[0] + p[1]*p[1] + p[2]*p[2]);
+        if(r > lod->radius){lod->radius = r;}
+    }
+
+    const unsigned int base = *nv;
+    unsigned int total = ni;
+    for(int l=1; l < LOD_LEVELS; l++)
+    {
+        lod->first[l] = lod->first[l-1];
+        lod->count[l] = lod->count[l-1];
+        vert* tv = malloc(base * sizeof(vert));
+        unsigned int* ti = malloc(ni * sizeof(unsigned int));
+        unsigned int tn = 0, tvn = 0;
+        if(tv != NULL && ti != NULL)
+            tvn = lodCluster(*rec, base, *idx, ni, lod_cell[l], tv, ti, &tn);
+        vert* nr = tn > 0 ? realloc(*rec, (*nv + tvn) * sizeof(vert)) : NULL;
+        if(nr != NULL){*rec = nr;}
+        unsigned int* ni2 = nr != NULL ? realloc(*idx, (total + tn) * sizeof(unsigned int)) : NULL;
+        if(ni2 != NULL)
+        {
+            *idx = ni2;
+            meshForsyth(ti, tn, tvn);
+            meshFetch((unsigned char*)tv, sizeof(vert), tvn, ti, tn);
+            memcpy(&(*rec)[*nv], tv, tvn * sizeof(vert));
+            for(unsigned int i=0; i < tn; i++)
+                (*idx)[total+i] = *nv + ti[i];
+            lod->first[l] = total;
+            lod->count[l] = tn;
+            total += tn;
+            *nv += tvn;
+        }
+        free(tv);
+        free(ti);
+    }
+    return total;
+}
+
+// picks the level for the model under the current modelview, state keeps
+// the last size based pick
+int lodPick(const lodchain* lod, int* state)
+{
+    const f32 w = projection.m[0][3]*modelview.m[3][0] + projection.m[1][3]*modelview.m[3][1] + projection.m[2][3]*modelview.m[3][2] + projection.m[3][3];
+    const f32 px = lod->radius * projection.m[1][1] * wh2 / w;
+    int k = 0;
+    for(int j=0; j < LOD_LEVELS-1; j++)
+        if(px < lod_px[j] * (*state > j ? 1.f + LOD_HYST : 1.f - LOD_HYST))
+            k = j+1;
+    *state = k;
+    k += lod_detail;
+    return k < LOD_LEVELS ? k : LOD_LEVELS-1;
+}
+
+// optimises and uploads a model, n and c are NULL for a position only
+// model and isz is the size of one of its indices, keep if not NULL gets
+// the optimised mesh of a lit model with 16 bit indices and lod if not
+// NULL gets the levels of detail of a lit model, which then always has
+// 16 bit indices
+void meshBind(ESModel* mdl, mesh* keep, lodchain* lod, const GLfloat* v, const GLfloat* n, const GLfloat* c, const GLsizeiptr vsize, const void* ind, const GLsizeiptr isize, const size_t isz)
+{
+    const size_t stride = n != NULL ? sizeof(vert) : sizeof(GLfloat)*3;
+    unsigned int nv = vsize / (sizeof(GLfloat)*3);
+    unsigned int ni = isize / isz;
+    unsigned char* rec = malloc(nv * stride);
+    unsigned int* idx = malloc(ni * sizeof(unsigned int));
+    if(rec == NULL || idx == NULL)
+    {
+        free(rec);
+        free(idx);
+        printf("ERROR: out of memory loading a model\n");
+        return;
+    }
+    if(n != NULL)
+        vertPack((vert*)rec, v, n, c, nv);
+    else
+        memcpy(rec, v, nv * stride);
+    for(unsigned int i=0; i < ni; i++)
+        idx[i] = isz == 1 ? ((const GLubyte*)ind)[i] : ((const GLushort*)ind)[i];
+
+    mesh_stats.tris += ni / 3;
+    mesh_stats.verts += nv;
+    mesh_stats.miss += meshMisses(idx, ni, nv);
+    nv = meshWeld(rec, stride, nv, idx, ni);
+    meshForsyth(idx, ni, nv);
+    meshFetch(rec, stride, nv, idx, ni);
+    mesh_stats.welded += nv;
+    mesh_stats.opt_miss += meshMisses(idx, ni, nv);
+
+    size_t osz = isz;
+    if(lod != NULL && n != NULL)
+    {
+        ni = lodBuild(lod, (vert**)&rec, &nv, &idx, ni);
+        osz = sizeof(GLushort);
+    }
+    void* out = malloc(ni * osz);
+    if(out == NULL)
+    {
+        free(rec);
+        free(idx);
+        printf("ERROR: out of memory loading a model\n");
+        return;
+    }
+    for(unsigned int i=0; i < ni; i++)
+    {
+        if(osz == 1)
+            ((GLubyte*)out)[i] = idx[i];
+        else
+            ((GLushort*)out)[i] = idx[i];
+    }
+    esBind(GL_ARRAY_BUFFER, &mdl->vid, rec, nv * stride, GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdl->iid, out, ni * osz, GL_STATIC_DRAW);
+    free(idx);
+    if(keep != NULL && n != NULL && isz == sizeof(GLushort))
+    {
+        keep->v = (vert*)rec;
+        keep->i = out;
+        keep->nv = nv;
+        keep->ni = ni;
+        return;
+    }
+    free(rec);
+    free(out);
+}
+
+
+//*************************************
+// vertex array objects
+//*************************************
+
+// Each model gets a VAO holding its attribute pointers and element buffer
+// so binding it is one call. A VAO stores attribute locations, so every
+// program is relinked with the same ones. GL 3.0, GLES3 and
+// GL_ARB_vertex_array_object have them built in, GLES2 gets them from
+// GL_OES_vertex_array_object. Without any of them the attributes are set
+// up on every bind as before.
+#define ATTRIB_POSITION 0
+#define ATTRIB_NORMAL 1
+#define ATTRIB_COLOR 2
+#define ATTRIB_OFFSET 3
+
+// links prog with the shared attribute locations
+void attribPin(const GLuint prog)
+{
+    glBindAttribLocation(prog, ATTRIB_POSITION, "position");
+    glBindAttribLocation(prog, ATTRIB_NORMAL, "normal");
+    glBindAttribLocation(prog, ATTRIB_COLOR, "color");
+    glBindAttribLocation(prog, ATTRIB_OFFSET, "offset");
+    glLinkProgram(prog);
+}
+
+// looks up the VAO entry points and relinks the esAux2 programs,
+// returns 0 and leaves vaoBind NULL without them
+int vaoInit()
+{
+#ifdef BUILD_GLFW
+    if(glad_glGenVertexArrays != NULL && glad_glBindVertexArray != NULL)
+    {
+        vaoGen = glad_glGenVertexArrays;
+        vaoBind = glad_glBindVertexArray;
+    }
+#else
+    const char* ver = (const char*)glGetString(GL_VERSION);
+    if(ver != NULL && strncmp(ver, "OpenGL ES 3", 11) == 0)
+    {
+        vaoGen = (PFNGLGENVERTEXARRAYSOESPROC)SDL_GL_GetProcAddress("glGenVertexArrays");
+        vaoBind = (PFNGLBINDVERTEXARRAYOESPROC)SDL_GL_GetProcAddress("glBindVertexArray");
+    }
+    else if(SDL_GL_ExtensionSupported("GL_OES_vertex_array_object") == SDL_TRUE)
+    {
+        vaoGen = (PFNGLGENVERTEXARRAYSOESPROC)SDL_GL_GetProcAddress("glGenVertexArraysOES");
+        vaoBind = (PFNGLBINDVERTEXARRAYOESPROC)SDL_GL_GetProcAddress("glBindVertexArrayOES");
+    }
+#endif
+    if(vaoGen == NULL || vaoBind == NULL)
+    {
+        vaoBind = NULL;
+        printf("Vertex array objects: off\n");
+        return 0;
+    }
+
+    attribPin(shdFullbright);
+    shdFullbright_position = ATTRIB_POSITION;
+    shdFullbright_projection = glGetUniformLocation(shdFullbright, "projection");
+    shdFullbright_modelview = glGetUniformLocation(shdFullbright,  "modelview");
+    shdFullbright_color = glGetUniformLocation(shdFullbright,      "color");
+    shdFullbright_opacity = glGetUniformLocation(shdFullbright,    "opacity");
+
+    attribPin(shdLambert3);
+    shdLambert3_position = ATTRIB_POSITION;
+    shdLambert3_normal = ATTRIB_NORMAL;
+    shdLambert3_color = ATTRIB_COLOR;
+    shdLambert3_projection = glGetUniformLocation(shdLambert3, "projection");
+    shdLambert3_modelview = glGetUniformLocation(shdLambert3,  "modelview");
+    shdLambert3_lightpos = glGetUniformLocation(shdLambert3,   "lightpos");
+    shdLambert3_opacity = glGetUniformLocation(shdLambert3,    "opacity");
+
+    printf("Vertex array objects: on\n");
+    return 1;
+}
+
+// records the buffers of mdl into a new VAO, a vert buffer if streams is 3
+// or just f32 positions
+void vaoMake(ESModel* mdl, const int streams)
+{
+    vaoGen(1, &mdl->vao);
+    gsVao(mdl->vao);
+    gsBuffer(GL_ARRAY_BUFFER, mdl->vid);
+    if(streams == 3)
+        vertPointers(ATTRIB_POSITION, ATTRIB_NORMAL, ATTRIB_COLOR, 0);
+    else
+    {
+        glVertexAttribPointer(ATTRIB_POSITION, 3, GL_FLOAT, GL_FALSE, 0, 0);
+        gsAttrib(ATTRIB_POSITION, 1);
+    }
+
+    gsBuffer(GL_ELEMENT_ARRAY_BUFFER, mdl->iid);
+    gsVao(0);
+}
+
+//*************************************
+// render functions
+//*************************************
+forceinline void modelBind1(const ESModel* mdl)
+{
+    if(mdl->vao != 0)
+    {
+        gsVao(mdl->vao);
+        return;
+    }
+    gsBuffer(GL_ARRAY_BUFFER, mdl->vid);
+    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    gsAttrib(position_id, 1);
+
+    gsBuffer(GL_ELEMENT_ARRAY_BUFFER, mdl->iid);
+}
+
+forceinline void modelBind3(const ESModel* mdl)
+{
+    if(mdl->vao != 0)
+    {
+        gsVao(mdl->vao);
+        return;
+    }
+    gsBuffer(GL_ARRAY_BUFFER, mdl->vid);
+    vertPointers(position_id, normal_id, color_id, 0);
+
+    gsBuffer(GL_ELEMENT_ARRAY_BUFFER, mdl->iid);
+}
+
+//*************************************
+// instanced coins
+//*************************************
+
+// Gold and silver coins are one mesh, each vertex keeps its class in the
+// 4th byte of its colour and shdLambert3i looks its colour up in
+// coin_palette by that and the coin's tint, 0 silver and 1 gold as in
+// coin.color. With instancing the whole pitch is then one draw and each
+// coin is just its x,y and tint in a stream buffer. GL 3.3 and GLES3 have
+// it built in, GLES2 gets it from GL_ANGLE_instanced_arrays or
+// GL_EXT_instanced_arrays and older desktop GL from GL_ARB_instanced_arrays.
+// Without them the stacks, the targeting coin and the one at a time
+// fallback still use shdLambert3i with the offset as a constant attribute.
+#define COIN_CLASSES 5
+#ifdef BUILD_GLFW
+    PFNGLDRAWELEMENTSINSTANCEDPROC instDraw = NULL;
+    PFNGLVERTEXATTRIBDIVISORPROC instDivisor = NULL;
+#else
+    PFNGLDRAWELEMENTSINSTANCEDEXTPROC instDraw = NULL;
+    PFNGLVERTEXATTRIBDIVISOREXTPROC instDivisor = NULL;
+#endif
+GLint offset_id;
+GLint scale_id;
+GLuint inst_vbo = 0;
+f32* inst_buf = NULL; // x,y,tint of every pitch coin
+unsigned int inst_max = 0;
+
+// the colours of coin.h, by class, as silver then as gold
+const f32 coin_palette[2][COIN_CLASSES][3] =
+{
+    {{0.706f, 0.761f, 0.886f}, {0.2f, 0.2f, 0.2f}, {0.765f, 0.635f, 0.188f}, {0.745f, 0.675f, 0.239f}, {0.706f, 0.761f, 0.886f}},
+    {{0.765f, 0.635f, 0.188f}, {0.2f, 0.2f, 0.2f}, {0.706f, 0.761f, 0.886f}, {0.698f, 0.784f, 0.98f}, {0.753f, 0.655f, 0.212f}}
+};
+
+// shadeLambert3() with the model reduced to a scale, a per coin offset
+// and the colour from the palette
+const GLchar* v13i =
+    "#version 100\n"
+    "uniform mat4 modelview;\n"
+    "uniform mat4 projection;\n"
+    "uniform float opacity;\n"
+    "uniform vec3 lightpos;\n"
+    "uniform vec3 scale;\n"
+    "uniform vec3 palette[10];\n"
+    "attribute vec4 position;\n"
+    "attribute vec3 normal;\n"
+    "attribute vec4 color;\n"
+    "attribute vec3 offset;\n"
+    "varying vec4 fragcolor;\n"
+    "void main()\n"
+    "{\n"
+        "vec4 vertPos4 = modelview * vec4(position.xyz * scale + vec3(offset.xy, 0.0), 1.0);\n"
+        "vec3 vertPos = vertPos4.xyz / vertPos4.w;\n"
+        "vec3 vertNorm = normalize(vec3(modelview * vec4(normal * scale, 0.0)));\n"
+        "vec3 lightDir = normalize(lightpos - vertPos);\n"
+        "vec3 col = palette[int(offset.z + 0.5) * 5 + int(color.a * 255.0 + 0.5)];\n"
+        "fragcolor = vec4((col * opacity) + max(dot(lightDir, vertNorm), 0.0)*col, opacity);\n"
+        "gl_Position = projection * vertPos4;\n"
+    "}\n";
+
+GLuint shdLambert3i;
+GLint  shdLambert3i_position;
+GLint  shdLambert3i_projection;
+GLint  shdLambert3i_modelview;
+GLint  shdLambert3i_lightpos;
+GLint  shdLambert3i_color;
+GLint  shdLambert3i_normal;
+GLint  shdLambert3i_opacity;
+GLint  shdLambert3i_offset;
+GLint  shdLambert3i_scale;
+
+void makeLambert3i()
+{
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &v13i, NULL);
+    glCompileShader(vertexShader);
+
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &f0, NULL);
+    glCompileShader(fragmentShader);
+
+    shdLambert3i = glCreateProgram();
+        glAttachShader(shdLambert3i, vertexShader);
+        glAttachShader(shdLambert3i, fragmentShader);
+    attribPin(shdLambert3i);
+
+    if(debugShader(shdLambert3i) == GL_FALSE){shdLambert3i = 0; return;}
+
+    shdLambert3i_position = glGetAttribLocation(shdLambert3i,    "position");
+    shdLambert3i_normal = glGetAttribLocation(shdLambert3i,      "normal");
+    shdLambert3i_color = glGetAttribLocation(shdLambert3i,       "color");
+    shdLambert3i_offset = glGetAttribLocation(shdLambert3i,      "offset");
+
+    shdLambert3i_projection = glGetUniformLocation(shdLambert3i, "projection");
+    shdLambert3i_modelview = glGetUniformLocation(shdLambert3i,  "modelview");
+    shdLambert3i_lightpos = glGetUniformLocation(shdLambert3i,   "lightpos");
+    shdLambert3i_opacity = glGetUniformLocation(shdLambert3i,    "opacity");
+    shdLambert3i_scale = glGetUniformLocation(shdLambert3i,      "scale");
+
+    glUseProgram(shdLambert3i);
+    glUniform3fv(glGetUniformLocation(shdLambert3i, "palette"), 2*COIN_CLASSES, &coin_palette[0][0][0]);
+}
+
+void shadeLambert3i()
+{
+    position_id = shdLambert3i_position;
+    projection_id = shdLambert3i_projection;
+    modelview_id = shdLambert3i_modelview;
+    lightpos_id = shdLambert3i_lightpos;
+    color_id = shdLambert3i_color;
+    normal_id = shdLambert3i_normal;
+    opacity_id = shdLambert3i_opacity;
+    offset_id = shdLambert3i_offset;
+    scale_id = shdLambert3i_scale;
+    glUseProgram(shdLambert3i);
+}
+
+// writes the class of every vertex of the gold coin m into its colour and
+// uploads it again to mdl
+void coinClasses(const ESModel* mdl, mesh* m)
+{
+    if(m->v == NULL){return;}
+    unsigned char c[COIN_CLASSES][4];
+    for(int k=0; k < COIN_CLASSES; k++)
+        packColor(c[k], coin_palette[1][k]);
+    for(unsigned int i=0; i < m->nv; i++)
+    {
+        int k = 0;
+        while(k < COIN_CLASSES && memcmp(m->v[i].c, c[k], 3) != 0){k++;}
+        if(k == COIN_CLASSES)
+        {
+            printf("WARNING: coin colour %u %u %u is not in coin_palette\n", m->v[i].c[0], m->v[i].c[1], m->v[i].c[2]);
+            k = 0;
+        }
+        m->v[i].c[3] = k;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, mdl->vid);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, m->nv * sizeof(vert), m->v);
+}
+
+// Without shdLambert3i nothing can apply the tint so the silver coin and
+// its stack column are baked from meshCoin, sharing the coin's indices.
+ESModel mdlSilver[2]; // coin, stack
+
+#ifdef GLSTATE_VERIFY
+// the program csp stands for
+GLuint gsProgram(const int prog)
+{
+    return prog == 0 ? shdFullbright : prog == 1 ? shdLambert3 : shdLambert3i;
+}
+#endif
+
+// looks up the instancing entry points, leaves instDraw NULL without them
+void instInit()
+{
+#ifdef BUILD_GLFW
+    if(glad_glDrawElementsInstanced != NULL && glad_glVertexAttribDivisor != NULL)
+    {
+        instDraw = glad_glDrawElementsInstanced;
+        instDivisor = glad_glVertexAttribDivisor;
+    }
+    else if(glfwExtensionSupported("GL_ARB_instanced_arrays") == GLFW_TRUE)
+    {
+        instDraw = (PFNGLDRAWELEMENTSINSTANCEDPROC)glfwGetProcAddress("glDrawElementsInstancedARB");
+        instDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glfwGetProcAddress("glVertexAttribDivisorARB");
+    }
+#else
+    const char* ver = (const char*)glGetString(GL_VERSION);
+    if(ver != NULL && strncmp(ver, "OpenGL ES 3", 11) == 0)
+    {
+        instDraw = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)SDL_GL_GetProcAddress("glDrawElementsInstanced");
+        instDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)SDL_GL_GetProcAddress("glVertexAttribDivisor");
+    }
+    else if(SDL_GL_ExtensionSupported("GL_ANGLE_instanced_arrays") == SDL_TRUE)
+    {
+        instDraw = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)SDL_GL_GetProcAddress("glDrawElementsInstancedANGLE");
+        instDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)SDL_GL_GetProcAddress("glVertexAttribDivisorANGLE");
+    }
+    else if(SDL_GL_ExtensionSupported("GL_EXT_instanced_arrays") == SDL_TRUE)
+    {
+        instDraw = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)SDL_GL_GetProcAddress("glDrawElementsInstancedEXT");
+        instDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)SDL_GL_GetProcAddress("glVertexAttribDivisorEXT");
+    }
+#endif
+    if(instDraw == NULL || instDivisor == NULL || shdLambert3i == 0)
+    {
+        instDraw = NULL;
+        printf("Instanced coins: off\n");
+        return;
+    }
+    glGenBuffers(1, &inst_vbo);
+    printf("Instanced coins: on\n");
+}
+
+// draws the pitch coins of sn, a of the way into the tick, in one call
+void drawCoinsInstanced(const f32 cs, const f32 a)
+{
+    if(inst_max < sn->num_coins)
+    {
+        f32* nb = realloc(inst_buf, sn->max_coins * 3 * sizeof(f32));
+        if(nb == NULL){return;}
+        inst_buf = nb;
+        inst_max = sn->max_coins;
+    }
+    unsigned int n = 0;
+    for(unsigned int i=3; i < sn->num_coins; i++)
+    {
+        const coin* c = &sn->coins[i];
+        if(c->color == -1){continue;}
+        inst_buf[n*3]   = simLerp(sn->prev[i].x, c->x, a);
+        inst_buf[n*3+1] = simLerp(sn->prev[i].y, c->y, a);
+        inst_buf[n*3+2] = c->color;
+        n++;
+    }
+    if(n == 0){return;}
+    gsBuffer(GL_ARRAY_BUFFER, inst_vbo);
+    glBufferData(GL_ARRAY_BUFFER, n * 3 * sizeof(f32), inst_buf, GL_STREAM_DRAW);
+
+    if(csp != 2)
+    {
+        shadeLambert3i();
+        csp = 2;
+    }
+    gsUniformMatrix(projection_id, &projection);
+    gsUniformMatrix(modelview_id, &view);
+    gsUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
+    gsUniform3f(scale_id, cs, cs, 2.f*cs);
+    gsUniform1f(opacity_id, 0.148f);
+
+    modelBind3(&mdlCoin);
+    gsBuffer(GL_ARRAY_BUFFER, inst_vbo);
+    glVertexAttribPointer(offset_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    gsAttrib(offset_id, 1);
+    instDivisor(offset_id, 1);
+    instDraw(GL_TRIANGLES, coin_numind, GL_UNSIGNED_SHORT, 0, n);
+    instDivisor(offset_id, 0);
+    gsAttrib(offset_id, 0);
+}
+
+//*************************************
+// batched coins
+//*************************************
+
+// Without instancing the pitch coins are put together on the CPU. The
+// vertex buffers hold a silver region and then a gold region, silver coins
+// are packed against the end of theirs and gold from the start of theirs
+// so the live coins are always one run of vertices and one run of indices.
+// Normals and colours (packed as in vert, the colours looked up in
+// coin_palette by the slot's tint) and indices only depend on the slot so
+// they are built when the slots grow, each frame only the positions are
+// written, a scaled copy of the mesh plus the coin's x,y four vertices at
+// a time, into a freshly orphaned buffer so the driver never waits on the
+// last frame's draw. With 32 bit indices that is one glDrawElements, GLES2 without
+// GL_OES_element_index_uint draws cb_group coins a call as that is as
+// many as a 16 bit index reaches.
+typedef f32 v4f __attribute__((vector_size(16)));
+typedef struct
+{
+    signed char n[4];
+    unsigned char c[4];
+} cbattr;
+int cb_on = 0;
+int cb_u32 = 0;
+unsigned int cb_group = 0; // 65536 / the coin mesh
+GLuint cb_vbo[2] = {0}; // f32 positions, cbattr normals and colours
+GLuint cb_ibo = 0;
+unsigned int cb_cap[2] = {0}; // silver and gold slots
+f32 cb_cs = 0.f;              // scale the normals and cb_mesh were built for
+f32* cb_mesh = NULL;          // coin mesh positions scaled by cb_cs
+f32* cb_pos = NULL;           // positions of every slot
+
+// finds out if 32 bit indices can be used and makes the buffers, only
+// when instDraw is NULL and the coin mesh was kept
+void cbInit()
+{
+    if(instDraw != NULL || meshCoin.v == NULL){return;}
+    cb_group = 65536 / meshCoin.nv;
+    const char* ver = (const char*)glGetString(GL_VERSION);
+    if(ver != NULL && (strstr(ver, "OpenGL ES") == NULL || strncmp(ver, "OpenGL ES 3", 11) == 0))
+        cb_u32 = 1;
+#ifdef BUILD_GLFW
+    else if(glfwExtensionSupported("GL_OES_element_index_uint") == GLFW_TRUE)
+        cb_u32 = 1;
+#else
+    else if(SDL_GL_ExtensionSupported("GL_OES_element_index_uint") == SDL_TRUE)
+        cb_u32 = 1;
+#endif
+    glGenBuffers(2, cb_vbo);
+    glGenBuffers(1, &cb_ibo);
+    cb_on = 1;
+    printf("Batched coins: on, %s bit indices\n", cb_u32 == 1 ? "32" : "16");
+}
+
+// grows the slots to hold ns silver and ng gold coins of scale cs,
+// returns 0 and turns batching off if it runs out of memory
+int cbReserve(const unsigned int ns, const unsigned int ng, const f32 cs)
+{
+    if(ns <= cb_cap[0] && ng <= cb_cap[1] && cs == cb_cs)
+        return 1;
+    const unsigned int need[2] = {ns, ng};
+    for(int k=0; k < 2; k++)
+        while(cb_cap[k] < need[k])
+            cb_cap[k] = cb_cap[k] == 0 ? cb_group*2 : cb_cap[k]*2;
+    cb_cs = cs;
+
+    const unsigned int nv = meshCoin.nv;
+    const unsigned int ni = meshCoin.ni;
+    const unsigned int verts = (cb_cap[0] + cb_cap[1]) * nv;
+    const unsigned int inds = (cb_cap[0] + cb_cap[1]) * ni;
+    const f32 sc[3] = {cs, cs, 2.f*cs};
+
+    f32* pos = realloc(cb_pos, verts * 3 * sizeof(f32));
+    if(pos != NULL){cb_pos = pos;}
+    cbattr* att = malloc(verts * sizeof(cbattr));
+    void* ind = malloc(inds * (cb_u32 == 1 ? sizeof(GLuint) : sizeof(GLushort)));
+    f32* m = realloc(cb_mesh, nv * 3 * sizeof(f32));
+    if(m != NULL){cb_mesh = m;}
+    if(m == NULL){pos = NULL;}
+    if(pos == NULL || att == NULL || ind == NULL)
+    {
+        free(att);
+        free(ind);
+        cb_cap[0] = cb_cap[1] = 0;
+        cb_on = 0;
+        printf("WARNING: out of memory for batched coins, drawing them one at a time\n");
+        return 0;
+    }
+
+    const vert* mv = meshCoin.v;
+    for(unsigned int j=0; j < nv*3; j++)
+        cb_mesh[j] = mv[j/3].p[j%3] * sc[j%3];
+    unsigned int v = 0, i = 0;
+    for(int k=0; k < 2; k++)
+    {
+        for(unsigned int s=0; s < cb_cap[k]; s++)
+        {
+            for(unsigned int j=0; j < nv; j++)
+            {
+                packNormal(att[v+j].n, mv[j].n[0] * sc[0], mv[j].n[1] * sc[1], mv[j].n[2] * sc[2]);
+                packColor(att[v+j].c, coin_palette[k][mv[j].c[3]]);
+            }
+            const unsigned int b = cb_u32 == 1 ? v : (s % cb_group) * nv;
+            for(unsigned int j=0; j < ni; j++, i++)
+            {
+                if(cb_u32 == 1)
+                    ((GLuint*)ind)[i] = b + meshCoin.i[j];
+                else
+                    ((GLushort*)ind)[i] = b + meshCoin.i[j];
+            }
+            v += nv;
+        }
+    }
+
+    gsBuffer(GL_ARRAY_BUFFER, cb_vbo[1]);
+    glBufferData(GL_ARRAY_BUFFER, verts * sizeof(cbattr), att, GL_STATIC_DRAW);
+    gsBuffer(GL_ELEMENT_ARRAY_BUFFER, cb_ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, inds * (cb_u32 == 1 ? sizeof(GLuint) : sizeof(GLushort)), ind, GL_STATIC_DRAW);
+    free(att);
+    free(ind);
+    return 1;
+}
+
+// writes mesh m of n vertices moved to x,y into o, 12 floats at a time
+forceinline void cbPlace(f32* o, const f32* m, const unsigned int n, const f32 x, const f32 y)
+{
+    const v4f a = {x, y, 0.f, x};
+    const v4f b = {y, 0.f, x, y};
+    const v4f c = {0.f, x, y, 0.f};
+    unsigned int j = 0;
+    for(; j+12 <= n*3; j += 12)
+    {
+        v4f p, q, r;
+        memcpy(&p, &m[j], sizeof(v4f));
+        memcpy(&q, &m[j+4], sizeof(v4f));
+        memcpy(&r, &m[j+8], sizeof(v4f));
+        p += a;
+        q += b;
+        r += c;
+        memcpy(&o[j], &p, sizeof(v4f));
+        memcpy(&o[j+4], &q, sizeof(v4f));
+        memcpy(&o[j+8], &r, sizeof(v4f));
+    }
+    for(; j < n*3; j += 3)
+    {
+        o[j]   = m[j] + x;
+        o[j+1] = m[j+1] + y;
+        o[j+2] = m[j+2];
+    }
+}
+
+// points the attributes at vertex v of the batch
+forceinline void cbBind(const unsigned int v)
+{
+    gsBuffer(GL_ARRAY_BUFFER, cb_vbo[0]);
+    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, (void*)(v * 3 * sizeof(f32)));
+    gsAttrib(position_id, 1);
+
+    gsBuffer(GL_ARRAY_BUFFER, cb_vbo[1]);
+    glVertexAttribPointer(normal_id, vert_attribs[1].size, vert_attribs[1].type, vert_attribs[1].norm, sizeof(cbattr), (void*)(v * sizeof(cbattr) + offsetof(cbattr, n)));
+    gsAttrib(normal_id, 1);
+    glVertexAttribPointer(color_id, vert_attribs[2].size, vert_attribs[2].type, vert_attribs[2].norm, sizeof(cbattr), (void*)(v * sizeof(cbattr) + offsetof(cbattr, c)));
+    gsAttrib(color_id, 1);
+
+    gsBuffer(GL_ELEMENT_ARRAY_BUFFER, cb_ibo);
+}
+
+// draws the pitch coins of sn, a of the way into the tick, with the
+// lambert3 shader bound, returns 0 if they were not drawn
+int drawCoinsBatched(const f32 cs, const f32 a)
+{
+    unsigned int ns = 0, ng = 0;
+    for(unsigned int i=3; i < sn->num_coins; i++)
+    {
+        if(sn->coins[i].color == 0){ns++;}
+        else if(sn->coins[i].color != -1){ng++;}
+    }
+    gsVao(0);
+    if(cbReserve(ns, ng, cs) == 0)
+        return 0;
+
+    const unsigned int nv = meshCoin.nv;
+    const unsigned int ni = meshCoin.ni;
+    const unsigned int gv = cb_cap[0] * nv; // first gold vertex
+    const unsigned int gi = cb_cap[0] * ni; // first gold index
+    unsigned int s = cb_cap[0] - ns, g = 0;
+    for(unsigned int i=3; i < sn->num_coins; i++)
+    {
+        const coin* c = &sn->coins[i];
+        if(c->color == -1){continue;}
+        const f32 x = simLerp(sn->prev[i].x, c->x, a);
+        const f32 y = simLerp(sn->prev[i].y, c->y, a);
+        if(c->color == 0)
+            cbPlace(&cb_pos[(s++ * nv) * 3], cb_mesh, nv, x, y);
+        else
+            cbPlace(&cb_pos[(gv + g++ * nv) * 3], cb_mesh, nv, x, y);
+    }
+    const unsigned int v0 = (cb_cap[0] - ns) * nv;
+    const unsigned int v1 = gv + ng * nv;
+    gsBuffer(GL_ARRAY_BUFFER, cb_vbo[0]);
+    glBufferData(GL_ARRAY_BUFFER, (gv + cb_cap[1] * nv) * 3 * sizeof(f32), NULL, GL_STREAM_DRAW);
+    if(v1 > v0)
+        glBufferSubData(GL_ARRAY_BUFFER, v0 * 3 * sizeof(f32), (v1 - v0) * 3 * sizeof(f32), &cb_pos[v0*3]);
+    gsUniformMatrix(modelview_id, &view);
+
+    if(cb_u32 == 1)
+    {
+        const unsigned int i0 = (cb_cap[0] - ns) * ni;
+        const unsigned int i1 = gi + ng * ni;
+        cbBind(0);
+        if(i1 > i0)
+            glDrawElements(GL_TRIANGLES, i1 - i0, GL_UNSIGNED_INT, (void*)(i0 * sizeof(GLuint)));
+        return 1;
+    }
+
+    // a draw per group of slots, silver then gold
+    const unsigned int first[2] = {cb_cap[0] - ns, 0};
+    const unsigned int last[2] = {cb_cap[0], ng};
+    for(int k=0; k < 2; k++)
+    {
+        const unsigned int rv = k == 0 ? 0 : gv;
+        const unsigned int ri = k == 0 ? 0 : gi;
+        for(unsigned int f = first[k]; f < last[k];)
+        {
+            const unsigned int gs = f - f % cb_group;
+            const unsigned int l = gs + cb_group < last[k] ? gs + cb_group : last[k];
+            cbBind(rv + gs * nv);
+            glDrawElements(GL_TRIANGLES, (l - f) * ni, GL_UNSIGNED_SHORT, (void*)((ri + f * ni) * sizeof(GLushort)));
+            f = l;
+        }
+    }
+    return 1;
+}
+
+//*************************************
+// render queue
+//*************************************
+
+// The frame's single model draws are queued with a sort key and drawn
+// together by rqFlush(), which radix sorts them by program, then model,
+// then opacity and front to back within that, so each program, model and
+// opacity is set once however the scene code submits them. The props are
+// layered over each other at the same depth so their items leave the
+// depth bits clear and keep the order they were submitted in. Coins all
+// share mdlCoin or mdlStack so their items carry the tint instead.
+#define RQ_FLAT 0 // shadeFullbright(), as csp
+#define RQ_LIT 1  // shadeLambert3(), as csp
+#define RQ_COIN 2 // shadeLambert3i(), as csp
+#define RQ_MODELS 64
+
+typedef struct
+{
+    unsigned int key;
+    int prog;
+    const ESModel* mdl;
+    f32 opacity;
+    f32 color[3];
+    f32 tint;
+    GLsizei count;
+    GLenum type;
+    size_t offset;
+    mat mv;
+} rq_item;
+rq_item* rq = NULL;
+unsigned int* rq_sort = NULL; // two key and two index arrays for the sort
+unsigned int rq_num = 0;
+unsigned int rq_max = 0;
+const ESModel* rq_models[RQ_MODELS]; // model of each key slot this frame
+unsigned int rq_num_models = 0;
+
+// selects a program, if not already current, and its projection
+void rqUse(const int prog)
+{
+    if(csp != prog)
+    {
+        if(prog == RQ_LIT)
+            shadeLambert3(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id);
+        else if(prog == RQ_COIN)
+            shadeLambert3i();
+        else
+            shadeFullbright(&position_id, &projection_id, &modelview_id, &color_id, &opacity_id);
+        csp = prog;
+    }
+    gsUniformMatrix(projection_id, &projection);
+    if(prog != RQ_FLAT)
+        gsUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
+    if(prog == RQ_COIN)
+        gsUniform3f(scale_id, 1.f, 1.f, 1.f);
+}
+
+// draws the queue now, the queue is empty after
+void rqFlush()
+{
+    if(rq_num == 0){return;}
+
+    // least significant byte first, skipping bytes every key shares
+    unsigned int* key = rq_sort;
+    unsigned int* idx = &rq_sort[rq_max];
+    unsigned int* tkey = &rq_sort[rq_max*2];
+    unsigned int* tidx = &rq_sort[rq_max*3];
+    for(unsigned int i=0; i < rq_num; i++)
+    {
+        key[i] = rq[i].key;
+        idx[i] = i;
+    }
+    for(int s=0; s < 32; s += 8)
+    {
+        unsigned int count[256] = {0};
+        for(unsigned int i=0; i < rq_num; i++)
+            count[(key[i] >> s) & 255]++;
+        if(count[(key[0] >> s) & 255] == rq_num){continue;}
+        unsigned int sum = 0;
+        for(int b=0; b < 256; b++)
+        {
+            const unsigned int c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+        for(unsigned int i=0; i < rq_num; i++)
+        {
+            const unsigned int d = count[(key[i] >> s) & 255]++;
+            tkey[d] = key[i];
+            tidx[d] = idx[i];
+        }
+        unsigned int* t = key; key = tkey; tkey = t;
+        t = idx; idx = tidx; tidx = t;
+    }
+
+    const ESModel* bound = NULL;
+    int prog = -1;
+    f32 tint = -1.f;
+    for(unsigned int i=0; i < rq_num; i++)
+    {
+        const rq_item* it = &rq[idx[i]];
+        if(it->prog != prog)
+        {
+            rqUse(it->prog);
+            prog = it->prog;
+            bound = NULL;
+        }
+        if(it->mdl != bound)
+        {
+            if(it->prog != RQ_FLAT)
+                modelBind3(it->mdl);
+            else
+                modelBind1(it->mdl);
+            bound = it->mdl;
+        }
+        gsUniform1f(opacity_id, it->opacity);
+        if(it->prog == RQ_FLAT)
+            gsUniform(color_id, 3, it->color);
+        if(it->prog == RQ_COIN && it->tint != tint)
+        {
+            glVertexAttrib3f(offset_id, 0.f, 0.f, it->tint);
+            tint = it->tint;
+        }
+        gsUniformMatrix(modelview_id, &it->mv);
+        glDrawElements(GL_TRIANGLES, it->count, it->type, (void*)it->offset);
+    }
+    rq_num = 0;
+    rq_num_models = 0;
+    GSVERIFY("rqFlush");
 }
 
-void newGame()
+// queues count indices of type from byte offset of mdl drawn with mv,
+// returns the item to fill the rest of in or NULL if there was no room
+rq_item* rqPush(const int prog, const ESModel* mdl, const mat* mv, const f32 opacity, const GLsizei count, const GLenum type, const size_t offset)
 {
-    // seed randoms
-    srand(time(0));
-
-    // defaults
-    gold_stack = 64.f;
-    silver_stack = 64.f;
-    active_coin = 0;
-    inmotion = 0;
-    gameover = 0.f;
-    trophies_clear();
-    for(int i=0; i < MAX_COINS; i++)
-    {
-        coins[i].color = -1;
-        coins[i].r = 0.3f;
-    }
-
-    // trophies
-    for(int i=0; i < 3; i++)
+    if(rq_num == rq_max)
     {
-        coins[i].color = fRand(1, 6);
-        coins[i].r = 0.36f;
-
-        coins[i].x = fRandFloat(-3.40863f, 3.40863f);
-        coins[i].y = fRandFloat(-4.03414f, 1.45439f-coins[i].r);
-        while(insidePitch(coins[i].x, coins[i].y, coins[i].r) == 0 || collision(i) == 1)
+        const unsigned int nm = rq_max == 0 ? 256 : rq_max*2;
+        rq_item* ni = realloc(rq, nm * sizeof(rq_item));
+        if(ni != NULL){rq = ni;}
+        unsigned int* ns = ni != NULL ? realloc(rq_sort, nm * 4 * sizeof(unsigned int)) : NULL;
+        if(ns == NULL)
+        {
+            // out of room, draw what is queued and start again
+            rqFlush();
+            if(rq_max == 0){return NULL;}
+        }
+        else
         {
-            coins[i].x = fRandFloat(-3.40863f, 3.40863f);
-            coins[i].y = fRandFloat(-4.03414f, 1.45439f-coins[i].r);
+            rq_sort = ns;
+            rq_max = nm;
         }
     }
 
-    // coins
-    const f32 lt = f32Time();
-    for(int i=3; i < MAX_COINS; i++)
-    {
-        coins[i].x = fRandFloat(-3.40863f, 3.40863f);
-        coins[i].y = fRandFloat(-4.03414f, 1.45439f-coins[i].r);
-        uint tl = 0;
-        while(insidePitch(coins[i].x, coins[i].y, coins[i].r) == 0 || collision(i) == 1)
-        {
-            coins[i].x = fRandFloat(-3.40863f, 3.40863f);
-            coins[i].y = fRandFloat(-4.03414f, 1.45439f-coins[i].r);
-            if(f32Time()-lt > 0.033){tl=1;break;} // 33ms timeout
-        }
-        if(tl==1){break;}
-        coins[i].color = fRand(0, 4);
-        if(coins[i].color > 1){coins[i].color = 0;}
-    }
-
-    // const int mc2 = MAX_COINS/2;
-    // for(int i=3; i < mc2; i++)
-    // {
-    //     coins[i].x = fRandFloat(-3.40863f, 3.40863f);
-    //     coins[i].y = fRandFloat(-4.03414f, 1.45439f-coins[i].r);
-    //     while(insidePitch(coins[i].x, coins[i].y, coins[i].r) == 0 || collision(i) == 1)
-    //     {
-    //         coins[i].x = fRandFloat(-3.40863f, 3.40863f);
-    //         coins[i].y = fRandFloat(-4.03414f, 1.45439f-coins[i].r);
-    //     }
-    //     coins[i].color = fRand(0, 4);
-    //     if(coins[i].color > 1){coins[i].color = 0;}
-    // }
+    unsigned int slot = 0;
+    while(slot < rq_num_models && rq_models[slot] != mdl){slot++;}
+    if(slot == rq_num_models && slot < RQ_MODELS)
+        rq_models[rq_num_models++] = mdl;
+    if(slot >= RQ_MODELS){slot = RQ_MODELS-1;} // still drawn right, just not grouped
 
-    rst = f32Time(); // round start time
+    rq_item* it = &rq[rq_num++];
+    it->key = ((unsigned int)(prog == RQ_FLAT ? 3 : prog) << 30) | (slot << 24);
+    if(prog != RQ_FLAT)
+    {
+        // front to back within the model and opacity
+        f32 z = -mv->m[3][2] * (65535.f/32.f);
+        if(z < 0.f){z = 0.f;}
+        else if(z > 65535.f){z = 65535.f;}
+        it->key |= ((unsigned int)(opacity * 255.f + 0.5f) << 16) | (unsigned int)z;
+    }
+    it->prog = prog;
+    it->mdl = mdl;
+    it->opacity = opacity;
+    it->count = count;
+    it->type = type;
+    it->offset = offset;
+    it->mv = *mv;
+    return it;
 }
 
-//*************************************
-// render functions
-//*************************************
-forceinline void modelBind1(const ESModel* mdl)
+// queues a shadeLambert3() draw
+forceinline void rqLit(const ESModel* mdl, const mat* mv, const f32 opacity, const GLsizei count, const GLenum type, const size_t offset)
 {
-    glBindBuffer(GL_ARRAY_BUFFER, mdl->vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
+    rqPush(RQ_LIT, mdl, mv, opacity, count, type, offset);
+}
+
+// queues count indices of mdlCoin or mdlStack, silver if tint is 0 and
+// gold if 1, from mdlSilver without shdLambert3i
+void rqCoin(const ESModel* mdl, const mat* mv, const f32 tint, const GLsizei count)
+{
+    if(shdLambert3i == 0 && tint == 0.f)
+        mdl = mdl == &mdlCoin ? &mdlSilver[0] : &mdlSilver[1];
+    rq_item* it = rqPush(shdLambert3i != 0 ? RQ_COIN : RQ_LIT, mdl, mv, 0.148f, count, GL_UNSIGNED_SHORT, 0);
+    if(it == NULL){return;}
+    it->tint = tint;
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdl->iid);
+// queues a shadeFullbright() draw
+void rqFlat(const ESModel* mdl, const mat* mv, const f32 r, const f32 g, const f32 b, const GLsizei count, const GLenum type, const size_t offset)
+{
+    rq_item* it = rqPush(RQ_FLAT, mdl, mv, 1.f, count, type, offset);
+    if(it == NULL){return;}
+    it->color[0] = r;
+    it->color[1] = g;
+    it->color[2] = b;
 }
 
-forceinline void modelBind3(const ESModel* mdl)
+// queues level k of a model with levels of detail
+forceinline void rqLod(const ESModel* mdl, const lodchain* lod, const int k, const f32 opacity)
 {
-    glBindBuffer(GL_ARRAY_BUFFER, mdl->cid);
-    glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(color_id);
+    rqLit(mdl, &modelview, opacity, lod->count[k], GL_UNSIGNED_SHORT, lod->first[k] * sizeof(GLushort));
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, mdl->vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
+//*************************************
+// coin stacks
+//*************************************
+
+// Each stack at the side is a prebuilt column of stack_block coins spaced
+// STACK_STEP apart, so a stack of n coins is one draw of the first n coins
+// worth of indices. stack_block is as many coins as a 16 bit index
+// reaches, a taller stack draws another column on top of that one.
+#define STACK_STEP 0.033f
+ESModel mdlStack;
+unsigned int stack_block = 65536; // cut down to 65536 / mesh vertices by stackBind()
+
+// builds the column of an optimised coin mesh into mdl
+void stackBind(ESModel* mdl, const mesh* m)
+{
+    if(m->v == NULL){return;}
+    stack_block = 65536 / m->nv < stack_block ? 65536 / m->nv : stack_block;
+    vert* vb = malloc(stack_block * m->nv * sizeof(vert));
+    GLushort* idx = malloc(stack_block * m->ni * sizeof(GLushort));
+    if(vb == NULL || idx == NULL)
+    {
+        // a column of one is the plain coin
+        free(vb);
+        free(idx);
+        stack_block = 1;
+        esBind(GL_ARRAY_BUFFER, &mdl->vid, m->v, m->nv * sizeof(vert), GL_STATIC_DRAW);
+        esBind(GL_ELEMENT_ARRAY_BUFFER, &mdl->iid, m->i, m->ni * sizeof(GLushort), GL_STATIC_DRAW);
+        return;
+    }
+    for(unsigned int b=0; b < stack_block; b++)
+    {
+        memcpy(&vb[b*m->nv], m->v, m->nv * sizeof(vert));
+        for(unsigned int j=0; j < m->nv; j++)
+            vb[(b*m->nv)+j].p[2] += STACK_STEP*b;
+        for(unsigned int j=0; j < m->ni; j++)
+            idx[(b*m->ni)+j] = (b*m->nv) + m->i[j];
+    }
+    esBind(GL_ARRAY_BUFFER, &mdl->vid, vb, stack_block * m->nv * sizeof(vert), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdl->iid, idx, stack_block * m->ni * sizeof(GLushort), GL_STATIC_DRAW);
+    free(vb);
+    free(idx);
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, mdl->nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
+// bakes mdlSilver from meshCoin
+void coinSilver()
+{
+    if(meshCoin.v == NULL){return;}
+    mesh m = meshCoin;
+    m.v = malloc(m.nv * sizeof(vert));
+    if(m.v == NULL){return;}
+    for(unsigned int i=0; i < m.nv; i++)
+    {
+        m.v[i] = meshCoin.v[i];
+        packColor(m.v[i].c, coin_palette[0][meshCoin.v[i].c[3]]);
+    }
+    esBind(GL_ARRAY_BUFFER, &mdlSilver[0].vid, m.v, m.nv * sizeof(vert), GL_STATIC_DRAW);
+    mdlSilver[0].iid = mdlCoin.iid;
+    stackBind(&mdlSilver[1], &m);
+    free(m.v);
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdl->iid);
+// queues a stack of n coins of tint with its bottom coin at x,y
+void drawStack(const f32 tint, const f32 n, const f32 x, const f32 y)
+{
+    const unsigned int c = (unsigned int)ceilf(n);
+    for(unsigned int b=0; b < c; b += stack_block)
+    {
+        mIdent(&model);
+        mTranslate(&model, x, y, STACK_STEP*b);
+        mMul(&modelview, &model, &view);
+        const unsigned int k = c-b < stack_block ? c-b : stack_block;
+        rqCoin(&mdlStack, &modelview, tint, k * coin_numind);
+    }
 }
 
 void doPerspective()
@@ -650,6 +4609,16 @@ void doPerspective()
     }
 }
 
+// pitch x of the drop lane under the mouse
+f32 dropX()
+{
+    if(mx < touch_margin)
+        return -1.90433f;
+    if(mx > ww-touch_margin)
+        return 1.90433f;
+    return -1.90433f+(((mx-touch_margin)*rww)*3.80866f);
+}
+
 //*************************************
 // update & render
 //*************************************
@@ -662,6 +4631,10 @@ void main_loop()
     t = f32Time();
     dt = t-lt;
     lt = t;
+    sn = simLatest();
+    f32 ia = (t - sn->time) * (f32)sim_hz; // how far into the next tick we are
+    if(ia < 0.f){ia = 0.f;}
+    else if(ia > 1.f){ia = 1.f;}
 
 //*************************************
 // input handling
@@ -671,7 +4644,23 @@ void main_loop()
     glfwGetCursorPos(wnd, &tmx, &tmy);
     mx = (f32)tmx;
     my = (f32)tmy;
+
+    // simulate at less detail while nobody is looking
+    if(glfwGetWindowAttrib(wnd, GLFW_ICONIFIED) == GLFW_TRUE)
+        sim_quality = QUALITY_HIDDEN;
+    else if(glfwGetWindowAttrib(wnd, GLFW_FOCUSED) == GLFW_FALSE)
+        sim_quality = QUALITY_BACKGROUND;
+    else
+        sim_quality = QUALITY_FOCUS;
 #else
+    const Uint32 wf = SDL_GetWindowFlags(wnd);
+    if((wf & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN)) != 0)
+        sim_quality = QUALITY_HIDDEN;
+    else if((wf & SDL_WINDOW_INPUT_FOCUS) == 0)
+        sim_quality = QUALITY_BACKGROUND;
+    else
+        sim_quality = QUALITY_FOCUS;
+
     SDL_Event event;
     while(SDL_PollEvent(&event))
     {
@@ -688,27 +4677,24 @@ void main_loop()
                 {
                     case SDL_BUTTON_LEFT:
 
-                        if (inmotion != 0 || event.button.button != SDL_BUTTON_LEFT)
+                        if (sn->inmotion != 0 || event.button.button != SDL_BUTTON_LEFT)
                             break;
 
-                        takeStack();
+                        if (sn->gameover == 0.f)
+                            simSend(SIM_DROP, dropX());
                         md = 1;
 
-                        if (gameover == 0.f) 
-                            break;
-
-                        if(f32Time() <= gameover+3.0f)
+                        if (newGameReady() == 0)
                             break;
-                        
-                        newGame();
 
-                        if(PUSH_SPEED >= 32.f)
-                            return;
-
-                        PUSH_SPEED += 1.f;
-                        char titlestr[256];
-                        sprintf(titlestr, "TuxPusher [%.1f]", PUSH_SPEED);
-                        SDL_SetWindowTitle(wnd, titlestr);
+                        if(PUSH_SPEED < 32.f)
+                        {
+                            PUSH_SPEED += 1.f;
+                            char titlestr[256];
+                            sprintf(titlestr, "TuxPusher [%.1f]", PUSH_SPEED);
+                            SDL_SetWindowTitle(wnd, titlestr);
+                        }
+                        simSend(SIM_NEWGAME, PUSH_SPEED);
 
                         return;
 
@@ -807,372 +4793,221 @@ void main_loop()
     else
         mRotY(&view, 62.f*DEG2RAD);
 
-    // inject a new figure if time has come
-    injectFigure();
-    
-    // prep scene for rendering
-    if(csp != 1)
-    {
-        shadeLambert3(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id);
-        glUniformMatrix4fv(projection_id, 1, GL_FALSE, (f32*) &projection.m[0][0]);
-        glUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
-        csp = 1;
-    }
-    glUniform1f(opacity_id, 0.148f);
-
-    // render scene
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &view.m[0][0]);
-    modelBind3(&mdlScene);
-    glDrawElements(GL_TRIANGLES, scene_numind, GL_UNSIGNED_SHORT, 0);
-
-    // detect gameover
-    if(gold_stack < 0.f){gold_stack = 0.f;}
-    if(silver_stack < 0.f){silver_stack = 0.f;}
-    if(gameover > 0.f && (gold_stack != 0.f || silver_stack != 0.f))
-    {
-        gameover = 0.f;
-    }
-    else if(gold_stack == 0.f && silver_stack == 0.f)
-    {
-        if(gameover == 0.f)
-            gameover = t+3.0f;
-    }
-
-    // coin
-    glUniform1f(opacity_id, 0.148f);
-
-    // targeting coin
-    if(gold_stack > 0.f || silver_stack > 0.f)
-    {
-        if(coins[active_coin].color == 1)
-            modelBind3(&mdlCoinSilver);
-        else
-            modelBind3(&mdlCoin);
-        if(inmotion == 0)
-        {
-            if(silver_stack > 0.f)
-                modelBind3(&mdlCoinSilver);
-            else
-                modelBind3(&mdlCoin);
-
-            mIdent(&model);
-            mScale(&model, 1.f, 1.f, 2.f);
-
-            if(mx < touch_margin)
-                mTranslate(&model, -1.90433f, -4.54055f, 0);
-            else if(mx > ww-touch_margin)
-                mTranslate(&model, 1.90433f, -4.54055f, 0);
-            else
-                mTranslate(&model, -1.90433f+(((mx-touch_margin)*rww)*3.80866f), -4.54055f, 0);
-
-            mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glDrawElements(GL_TRIANGLES, coin_numind, GL_UNSIGNED_SHORT, 0);
-        }
-    }
-
-    // do motion
-    if(inmotion == 1)
+    // pitch coins
+    const f32 cs = sn->coin_r * 3.333333333f; // relative to the 0.3 radius mesh
+    if(instDraw != NULL)
+        drawCoinsInstanced(cs, ia);
+    else
     {
-        if(coins[active_coin].y < -3.73414f)
-        {
-            coins[active_coin].y += PUSH_SPEED * dt;
-            for(int i=0; i < 6; i++) // six seems enough
-                stepCollisions();
-        }
-        else
+        rqUse(RQ_LIT);
+        gsUniform1f(opacity_id, 0.148f);
+        if(cb_on == 0 || drawCoinsBatched(cs, ia) == 0)
         {
-            inmotion = 0;
-
-            if(isnewcoin > 0)
+            for(unsigned int i=3; i < sn->num_coins; i++)
             {
-                if(isnewcoin == 1)
-                    silver_stack -= 1.f;
-                else
-                    gold_stack -= 1.f;
+                if(sn->coins[i].color == -1)
+                    continue;
 
-                isnewcoin = 0;
+                mIdent(&model);
+                mTranslate(&model, simLerp(sn->prev[i].x, sn->coins[i].x, ia), simLerp(sn->prev[i].y, sn->coins[i].y, ia), 0.f);
+                mScale(&model, cs, cs, 2.f*cs);
+                mMul(&modelview, &model, &view);
+                rqCoin(&mdlCoin, &modelview, sn->coins[i].color, coin_numind);
             }
         }
     }
 
-    // gold stack
-    modelBind3(&mdlCoin);
-    f32 gss = gold_stack;
-    if(silver_stack == 0.f){gss -= 1.f;}
-    if(gss < 0.f){gss = 0.f;}
-    for(f32 i = 0.f; i < gss; i += 1.f)
-    {
-        mIdent(&model);
-        if(ortho == 0)
-            mTranslate(&model, -2.62939f, -4.54055f, 0.033f*i);
-        else
-            mTranslate(&model, -4.62939f, -4.54055f, 0.033f*i);
-        mMul(&modelview, &model, &view);
-        glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-        glDrawElements(GL_TRIANGLES, coin_numind, GL_UNSIGNED_SHORT, 0);
-    }
+    // render scene
+    rqLit(&mdlScene, &view, 0.148f, scene_numind, GL_UNSIGNED_SHORT, 0);
 
-    // silver stack
-    modelBind3(&mdlCoinSilver);
-    f32 sss = silver_stack-1.f;
-    if(sss < 0.f){sss = 0.f;}
-    for(f32 i = 0.f; i < sss; i += 1.f)
+    // targeting coin
+    if((sn->gold_stack > 0.f || sn->silver_stack > 0.f) && sn->inmotion == 0)
     {
         mIdent(&model);
-        if(ortho == 0)
-            mTranslate(&model, 2.62939f, -4.54055f, 0.033f*i);
-        else
-            mTranslate(&model, 4.62939f, -4.54055f, 0.033f*i);
+        mTranslate(&model, dropX(), -4.54055f, 0);
+        mScale(&model, cs, cs, 2.f*cs);
         mMul(&modelview, &model, &view);
-        glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-        glDrawElements(GL_TRIANGLES, coin_numind, GL_UNSIGNED_SHORT, 0);
+        rqCoin(&mdlCoin, &modelview, sn->silver_stack > 0.f ? 0.f : 1.f, coin_numind);
     }
 
-    // pitch coins
-    for(int i=3; i < MAX_COINS; i++)
-    {
-        if(coins[i].color == -1)
-            continue;
-        
-        if(coins[i].color == 0)
-            modelBind3(&mdlCoinSilver);
-        else
-            modelBind3(&mdlCoin);
-
-        mIdent(&model);
-        mScale(&model, 1.f, 1.f, 2.f);
-        mTranslate(&model, coins[i].x, coins[i].y, 0.f);
-        mMul(&modelview, &model, &view);
-        glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-        glDrawElements(GL_TRIANGLES, coin_numind, GL_UNSIGNED_SHORT, 0);
-    }
+    // gold stack
+    f32 gss = sn->gold_stack;
+    if(sn->silver_stack == 0.f){gss -= 1.f;}
+    if(gss < 0.f){gss = 0.f;}
+    drawStack(1.f, gss, ortho == 0 ? -2.62939f : -4.62939f, -4.54055f);
 
-    // tux is fancy
-    shadeLambert3(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id);
-    glUniformMatrix4fv(projection_id, 1, GL_FALSE, (f32*) &projection.m[0][0]);
-    glUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
-    glUniform1f(opacity_id, 0.148f);
+    // silver stack
+    f32 sss = sn->silver_stack-1.f;
+    if(sss < 0.f){sss = 0.f;}
+    drawStack(0.f, sss, ortho == 0 ? 2.62939f : 4.62939f, -4.54055f);
 
     // trophies
     for(int i=0; i < 3; i++)
     {
         mIdent(&model);
-        mTranslate(&model, coins[i].x, coins[i].y, 0.f);
+        mTranslate(&model, simLerp(sn->prev[i].x, sn->coins[i].x, ia), simLerp(sn->prev[i].y, sn->coins[i].y, ia), 0.f);
         mMul(&modelview, &model, &view);
-        glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
+        const int lv = lodPick(&lodTux, &lod_state[i]);
         
         // Draw the base Tux model, this will be our base to add apparel onto
-        glUniform1f(opacity_id, 0.148f);
-        modelBind3(&mdlTux);
-        glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
+        rqLod(&mdlTux, &lodTux, lv, 0.148f);
 
         // Tux Skin Selection.
-        switch (coins[i].color) {
+        switch (sn->coins[i].color) {
             case 2:
-                glUniform1f(opacity_id, 0.5f);
-                modelBind3(&mdlEvil);
-                glDrawElements(GL_TRIANGLES, evil_numind, GL_UNSIGNED_BYTE, 0);
+                rqLod(&mdlEvil, &lodEvil, lv, 0.5f);
                 break;
             case 3:
-                glUniform1f(opacity_id, 0.6f);
-                modelBind3(&mdlKing);
-                glDrawElements(GL_TRIANGLES, king_numind, GL_UNSIGNED_BYTE, 0);
+                rqLod(&mdlKing, &lodKing, lv, 0.6f);
                 break;
             case 4:
-                modelBind3(&mdlNinja);
-                glDrawElements(GL_TRIANGLES, ninja_numind, GL_UNSIGNED_BYTE, 0);
+                rqLod(&mdlNinja, &lodNinja, lv, 0.148f);
                 break;
             case 5:
-                glUniform1f(opacity_id, 0.4f);
-                modelBind3(&mdlSurf);
-                glDrawElements(GL_TRIANGLES, surf_numind, GL_UNSIGNED_SHORT, 0);
+                rqLod(&mdlSurf, &lodSurf, lv, 0.4f);
                 break;
             case 6:
-                glUniform1f(opacity_id, 0.5f);
-                modelBind3(&mdlTrip);
-                glDrawElements(GL_TRIANGLES, trip_numind, GL_UNSIGNED_SHORT, 0);
+                rqLod(&mdlTrip, &lodTrip, lv, 0.5f);
                 break;
         }
     }
 
     //
 
-    if (trophies_all()) // Are there any trophies that need to be rendered?
+    if (trophies_all(sn)) // Are there any trophies that need to be rendered?
     { 
-        if(trophies_get(0))
+        if(trophies_get(sn, 0))
         {
             mIdent(&model);
             mTranslate(&model, 3.92732f, 1.0346f, 0.f);
             mRotZ(&model, t*0.3f);
             mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform1f(opacity_id, 0.148f);
-            modelBind3(&mdlTux);
-            glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
+            const int lv = lodPick(&lodTux, &lod_state[3]);
+            rqLod(&mdlTux, &lodTux, lv, 0.148f);
         }
-        if(trophies_get(1))
+        if(trophies_get(sn, 1))
         {
             mIdent(&model);
             mTranslate(&model, 3.65552f, -1.30202f, 0.f);
             mRotZ(&model, t*0.3f);
             mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform1f(opacity_id, 0.148f);
-            modelBind3(&mdlTux);
-            glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
-            glUniform1f(opacity_id, 0.5f);
-            modelBind3(&mdlEvil);
-            glDrawElements(GL_TRIANGLES, evil_numind, GL_UNSIGNED_BYTE, 0);
+            const int lv = lodPick(&lodTux, &lod_state[4]);
+            rqLod(&mdlTux, &lodTux, lv, 0.148f);
+            rqLod(&mdlEvil, &lodEvil, lv, 0.5f);
         }
-        if(trophies_get(2))
+        if(trophies_get(sn, 2))
         {
             mIdent(&model);
             mTranslate(&model, 3.01911f, -3.23534f, 0.f);
             mRotZ(&model, t*0.3f);
             mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform1f(opacity_id, 0.148f);
-            modelBind3(&mdlTux);
-            glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
-            glUniform1f(opacity_id, 0.6f);
-            modelBind3(&mdlKing);
-            glDrawElements(GL_TRIANGLES, king_numind, GL_UNSIGNED_BYTE, 0);
+            const int lv = lodPick(&lodTux, &lod_state[5]);
+            rqLod(&mdlTux, &lodTux, lv, 0.148f);
+            rqLod(&mdlKing, &lodKing, lv, 0.6f);
         }
-        if(trophies_get(3))
+        if(trophies_get(sn, 3))
         {
             mIdent(&model);
             mTranslate(&model, -3.92732f, 1.0346f, 0.f);
             mRotZ(&model, t*0.3f);
             mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform1f(opacity_id, 0.148f);
-            modelBind3(&mdlTux);
-            glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
-            modelBind3(&mdlNinja);
-            glDrawElements(GL_TRIANGLES, ninja_numind, GL_UNSIGNED_BYTE, 0);
+            const int lv = lodPick(&lodTux, &lod_state[6]);
+            rqLod(&mdlTux, &lodTux, lv, 0.148f);
+            rqLod(&mdlNinja, &lodNinja, lv, 0.148f);
         }
-        if(trophies_get(4))
+        if(trophies_get(sn, 4))
         {
             mIdent(&model);
             mTranslate(&model, -3.65552f, -1.30202f, 0.f);
             mRotZ(&model, t*0.3f);
             mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform1f(opacity_id, 0.148f);
-            modelBind3(&mdlTux);
-            glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
-            glUniform1f(opacity_id, 0.4f);
-            modelBind3(&mdlSurf);
-            glDrawElements(GL_TRIANGLES, surf_numind, GL_UNSIGNED_SHORT, 0);
+            const int lv = lodPick(&lodTux, &lod_state[7]);
+            rqLod(&mdlTux, &lodTux, lv, 0.148f);
+            rqLod(&mdlSurf, &lodSurf, lv, 0.4f);
         }
-        if(trophies_get(5))
+        if(trophies_get(sn, 5))
         {
             mIdent(&model);
             mTranslate(&model, -3.01911f, -3.23534f, 0.f);
             mRotZ(&model, t*0.3f);
             mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform1f(opacity_id, 0.148f);
-            modelBind3(&mdlTux);
-            glDrawElements(GL_TRIANGLES, tux_numind, GL_UNSIGNED_SHORT, 0);
-            glUniform1f(opacity_id, 0.5f);
-            modelBind3(&mdlTrip);
-            glDrawElements(GL_TRIANGLES, trip_numind, GL_UNSIGNED_SHORT, 0);
+            const int lv = lodPick(&lodTux, &lod_state[8]);
+            rqLod(&mdlTux, &lodTux, lv, 0.148f);
+            rqLod(&mdlTrip, &lodTrip, lv, 0.5f);
         }
     }
 
     // render scene props
-    const f32 std = t-rst;
-    if((gameover > 0.f && t > gameover) || std < 6.75f)
+    const f32 std = t-sn->rst;
+    if(std < 6.75f)
     {
-        shadeFullbright(&position_id, &projection_id, &modelview_id, &color_id, &opacity_id);
-        glUniformMatrix4fv(projection_id, 1, GL_FALSE, (f32*) &projection.m[0][0]);
-        glUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
-        csp = 0;
+        if((std > 1.5f && std < 2.f) || (std > 2.5f && std < 3.f) || (std > 3.5f && std < 4.f))
+            rqFlat(&mdlRX, &view, 0.89f, 0.f, 0.157f, rx_numind, GL_UNSIGNED_BYTE, 0);
 
-        if(std < 6.75f)
+        if((std > 4.5f && std < 4.75f) || (std > 5.f && std < 5.25f))
         {
-            if((std > 1.5f && std < 2.f) || (std > 2.5f && std < 3.f) || (std > 3.5f && std < 4.f))
-            {
-                glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &view.m[0][0]);
-                glUniform3f(color_id, 0.89f, 0.f, 0.157f);
-                modelBind1(&mdlRX);
-                glDrawElements(GL_TRIANGLES, rx_numind, GL_UNSIGNED_BYTE, 0);
-            }
-
-            if((std > 4.5f && std < 4.75f) || (std > 5.f && std < 5.25f))
-            {
-                modelBind1(&mdlSA);
-
-                mIdent(&model);
-                mTranslate(&model, -0.01f, 0.01f, 0.f);
-                mMul(&modelview, &model, &view);
-                glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-                glUniform3f(color_id, 0.f, 0.f, 0.f);
-                glDrawElements(GL_TRIANGLES, sa_numind, GL_UNSIGNED_BYTE, 0);
-                
-                glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &view.m[0][0]);
-                glUniform3f(color_id, 0.714f, 0.741f, 0.8f);
-                glDrawElements(GL_TRIANGLES, sa_numind, GL_UNSIGNED_BYTE, 0);
-            }
-
-            if((std > 5.5f && std < 5.75f) || (std > 6.f && std < 6.75f))
-            {
-                f32 step = (std-6.25f)*2.f;
-                if(step < 0.f){step = 0.f;}
-                glUniform3f(color_id, 0.698f - (0.16859f * step), 0.667f + (0.14084f * step), 0.263f + (0.65857f * step));
-                glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &view.m[0][0]);
-                modelBind1(&mdlGA);
-                glDrawElements(GL_TRIANGLES, ga_numind, GL_UNSIGNED_BYTE, 0);
-            }
+            mIdent(&model);
+            mTranslate(&model, -0.01f, 0.01f, 0.f);
+            mMul(&modelview, &model, &view);
+            rqFlat(&mdlSA, &modelview, 0.f, 0.f, 0.f, sa_numind, GL_UNSIGNED_BYTE, 0);
+            rqFlat(&mdlSA, &view, 0.714f, 0.741f, 0.8f, sa_numind, GL_UNSIGNED_BYTE, 0);
         }
 
-        // render game over
-        if(gameover > 0.f && t > gameover)
+        if((std > 5.5f && std < 5.75f) || (std > 6.f && std < 6.75f))
         {
-            glDisable(GL_DEPTH_TEST);
-            glEnable(GL_BLEND);
+            f32 step = (std-6.25f)*2.f;
+            if(step < 0.f){step = 0.f;}
+            rqFlat(&mdlGA, &view, 0.698f - (0.16859f * step), 0.667f + (0.14084f * step), 0.263f + (0.65857f * step), ga_numind, GL_UNSIGNED_BYTE, 0);
+        }
+    }
+    rqFlush();
 
-            modelBind1(&mdlPlane);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &view.m[0][0]);
-            glUniform3f(color_id, 0.f, 0.f, 0.f);
-            f32 opa = t-gameover;
-            if(opa > 0.8f){opa = 0.8f;}
-            glUniform1f(opacity_id, opa);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, 0);
-            
-            glUniform1f(opacity_id, 0.5f);
-            modelBind1(&mdlGameover);
+    // render game over
+    if(sn->gameover > 0.f && t > sn->gameover)
+    {
+        rqUse(RQ_FLAT);
+        gsCap(GL_DEPTH_TEST, 0);
+        gsCap(GL_BLEND, 1);
+
+        modelBind1(&mdlPlane);
+        gsUniformMatrix(modelview_id, &view);
+        gsUniform3f(color_id, 0.f, 0.f, 0.f);
+        f32 opa = t-sn->gameover;
+        if(opa > 0.8f){opa = 0.8f;}
+        gsUniform1f(opacity_id, opa);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, 0);
+        
+        gsUniform1f(opacity_id, 0.5f);
+        modelBind1(&mdlGameover);
 
-            mIdent(&model);
-            mTranslate(&model, -0.01f, 0.01f, 0.01f);
-            mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform3f(color_id, 0.f, 0.f, 0.f);
-            glDrawElements(GL_TRIANGLES, gameover_numind, GL_UNSIGNED_SHORT, 0);
+        mIdent(&model);
+        mTranslate(&model, -0.01f, 0.01f, 0.01f);
+        mMul(&modelview, &model, &view);
+        gsUniformMatrix(modelview_id, &modelview);
+        gsUniform3f(color_id, 0.f, 0.f, 0.f);
+        glDrawElements(GL_TRIANGLES, gameover_numind, GL_UNSIGNED_SHORT, 0);
 
-            mIdent(&model);
-            mTranslate(&model, 0.005f, -0.005f, -0.005f);
-            mMul(&modelview, &model, &view);
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-            glUniform3f(color_id, 0.2f, 0.2f, 0.2f);
-            glDrawElements(GL_TRIANGLES, gameover_numind, GL_UNSIGNED_SHORT, 0);
-
-            const f32 ts = t*0.3f;
-            glUniform3f(color_id, fabsf(cosf(ts)), fabsf(sinf(ts)), fabsf(cosf(ts)));
-            glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &view.m[0][0]);
-            glDrawElements(GL_TRIANGLES, gameover_numind, GL_UNSIGNED_SHORT, 0);
-            
-            glDisable(GL_BLEND);
-            glEnable(GL_DEPTH_TEST);
-        }
+        mIdent(&model);
+        mTranslate(&model, 0.005f, -0.005f, -0.005f);
+        mMul(&modelview, &model, &view);
+        gsUniformMatrix(modelview_id, &modelview);
+        gsUniform3f(color_id, 0.2f, 0.2f, 0.2f);
+        glDrawElements(GL_TRIANGLES, gameover_numind, GL_UNSIGNED_SHORT, 0);
+
+        const f32 ts = t*0.3f;
+        gsUniform3f(color_id, fabsf(cosf(ts)), fabsf(sinf(ts)), fabsf(cosf(ts)));
+        gsUniformMatrix(modelview_id, &view);
+        glDrawElements(GL_TRIANGLES, gameover_numind, GL_UNSIGNED_SHORT, 0);
+        
+        gsCap(GL_BLEND, 0);
+        gsCap(GL_DEPTH_TEST, 1);
     }
 
 
 //*************************************
 // swap buffers / display render
 //*************************************
+    GSVERIFY("frame");
 #ifdef BUILD_GLFW
     glfwSwapBuffers(wnd);
 #else
@@ -1188,13 +5023,12 @@ void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
 {
     if(action == GLFW_PRESS)
     {
-        if(inmotion == 0 && button == GLFW_MOUSE_BUTTON_LEFT)
+        if(sn->inmotion == 0 && button == GLFW_MOUSE_BUTTON_LEFT)
         {
-            if(gameover > 0.f)
+            if(sn->gameover > 0.f)
             {
-                if(glfwGetTime() > gameover+3.0f)
+                if(newGameReady() == 1)
                 {
-                    newGame();
                     if(PUSH_SPEED < 32.f)
                     {
                         PUSH_SPEED += 1.f;
@@ -1202,10 +5036,11 @@ void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
                         sprintf(titlestr, "TuxPusher [%.1f]", PUSH_SPEED);
                         glfwSetWindowTitle(window, titlestr);
                     }
+                    simSend(SIM_NEWGAME, PUSH_SPEED);
                 }
                 return;
             }
-            takeStack();
+            simSend(SIM_DROP, dropX());
             md = 1;
         }
         else if(button == GLFW_MOUSE_BUTTON_RIGHT)
@@ -1323,8 +5158,36 @@ unsigned int BenchmarkFunction(void (*F)(), int samples)
     }
     return average/samples;
 }
+
+// As BenchmarkFunction() but calls R untimed before every sample so F
+// runs on the same state each time.
+unsigned int BenchmarkFunctionReset(void (*F)(), void (*R)(), int samples)
+{
+    R();
+    (*F)(); // Preempt the function to skip initializations
+    unsigned int average = 0;
+    for (int i = 0; i < samples; i++)
+    {
+        struct timespec InitalTime;
+        struct timespec FinalTime;
+        R();
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &InitalTime);
+        (*F)(); // execute function
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &FinalTime);
+        average += FinalTime.tv_nsec - InitalTime.tv_nsec;
+    }
+    if (average % 2 == 1) { // odd number detected!
+        average += 1;
+    }
+    return average/samples;
+}
 #endif
 
+// the benchmarks drive the main table
+void benchStepCollisions(){tbl.num_events = 0; stepCollisions(&tbl);}
+void benchResetTable(){tableReset(&tbl, NULL);}
+void benchTakeStack(){takeStack(&tbl, 0.f);}
+void benchInjectFigure(){injectFigure(&tbl, NULL);}
 
 // A small function to perform djb2 hash algorithm. This is for quick string checking and other hash needs.
 // More info here: https://github.com/dim13/djb2/blob/master/docs/hash.md
@@ -1349,6 +5212,34 @@ int main(int argc, char** argv)
     // Vertical sync option. 0 for immediate updates, 1 for updates synchronized with the vertical retrace, -1 for adaptive vsync
     int option_vsync = 1;
 
+    // opening layout file to preload the layout bank from
+    const char* option_layouts = NULL;
+
+    // pitch coins the opening layout is filled to and their radius
+    unsigned int option_coins = DEFAULT_COINS;
+    f32 option_coin_r = 0.3f;
+
+    // cabinet outline, NULL for the built in one
+    const char* option_pitch = NULL;
+
+    // collision solver threads, 0 for the single threaded solver
+    int option_threads = 0;
+
+    // fuzz the solvers for this many seconds or replay one fuzz case
+    int option_fuzz = 0;
+    const char* option_fuzz_case = NULL;
+
+    // play this many games headless, optionally tallying a heatmap
+    unsigned int option_simulate = 0;
+    unsigned int option_seed = time(0);
+    const char* option_heatmap = NULL;
+    const char* option_records = NULL;
+
+    // run the benchmarks or write a layout file once the arguments are read
+    uint option_benchmark = 0;
+    const char* option_make_layouts = NULL;
+    int option_make_count = 0;
+
     // Evaluate hashes for comparing arguments later...
     const int HASHGEN = 285276507; // --generate-hash
     const int TINY_HASHGEN = 193429505; // -gh
@@ -1368,6 +5259,42 @@ int main(int argc, char** argv)
     const int ARG_BENCHMARK = 3795426538; // --benchmark
     const int ARG_BENCHMARK_TINY = 193429345; // -bm
 
+    const int LAYOUTBANK = 2253093638; // --layout-bank
+    const int TINY_LAYOUTBANK = 193429664; // -lb
+
+    const int MAKELAYOUTS = 1541167867; // --make-layouts
+    const int TINY_MAKELAYOUTS = 193429707; // -ml
+
+    const int COINS = 4226979035; // --coins
+    const int TINY_COINS = 193429379; // -cn
+
+    const int COINRADIUS = 859239677; // --coin-radius
+    const int TINY_COINRADIUS = 193429383; // -cr
+
+    const int PITCHFILE = 4242191991; // --pitch
+    const int TINY_PITCHFILE = 193429814; // -pt
+
+    const int THREADS = 3486700010; // --threads
+    const int TINY_THREADS = 193429934; // -th
+
+    const int FUZZ = 1950312526; // --fuzz
+    const int TINY_FUZZ = 193429490; // -fz
+
+    const int FUZZCASE = 1165561111; // --fuzz-case
+    const int TINY_FUZZCASE = 193429467; // -fc
+    const int TICKRATE = 2210440099; // --tick-rate
+    const int TINY_TICKRATE = 193429944; // -tr
+    const int SIMULATE = 543371235; // --simulate
+    const int TINY_SIMULATE = 193429906; // -sm
+    const int SEED = 1950761568; // --seed
+    const int TINY_SEED = 193429897; // -sd
+    const int HEATMAP = 736971455; // --heatmap
+    const int TINY_HEATMAP = 193429543; // -hm
+    const int RECORDS = 768946961; // --records
+    const int TINY_RECORDS = 193429863; // -rc
+    const int DETAIL = 2079011794; // --detail
+    const int TINY_DETAIL = 193429410; // -dl
+
     // Loop through console arguments and adjust program accordingly.
     // i starts at one to skip the program name.
     for (int i = 1; i < argc; i++) {
@@ -1384,14 +5311,8 @@ int main(int argc, char** argv)
                 exit(0);
             case ARG_BENCHMARK:
             case ARG_BENCHMARK_TINY: // Benchmark multiple aspects of the game.
-                printf("==============================\n\n   -= Benchmark results =-\n\n");
-                printf("Collision Function: %i ns\n", BenchmarkFunction((void(*)())stepCollisions, 512));
-                printf("Take Stack: %i ns\n", BenchmarkFunction((void(*)())takeStack, 512));
-                printf("inject Figures: %i ns\n", BenchmarkFunction((void(*)())injectFigure, 512));
-                printf("New Game Function: %i ns\n\n", BenchmarkFunction((void(*)())newGame, 16));
-                printf("Inside Pitch: %i ns\n", BenchmarkFunction((void(*)())insidePitch, 512));
-                printf("\n==============================\n");
-                exit(0);
+                option_benchmark = 1;
+                break;
             case MSAALEVEL: // Change the MSAA level.
             case TINY_MSAALEVEL:
                 option_msaa = atoi(argv[i+1]);
@@ -1417,7 +5338,136 @@ int main(int argc, char** argv)
                 }
                 printf("Successfully set Push speed to %f", PUSH_SPEED);
                 break;
+            case LAYOUTBANK: // Preload the opening layout bank from a file.
+            case TINY_LAYOUTBANK:
+                option_layouts = argv[i+1];
+                break;
+            case MAKELAYOUTS: // Write a file of opening layouts and quit.
+            case TINY_MAKELAYOUTS:
+                if(i+2 >= argc || atoi(argv[i+2]) <= 0)
+                {
+                    printf("Usage: --make-layouts {FILE} {COUNT}\n");
+                    exit(EXIT_FAILURE);
+                }
+                option_make_layouts = argv[i+1];
+                option_make_count = atoi(argv[i+2]);
+                break;
+            case COINS: // Change how many coins the pitch opens with.
+            case TINY_COINS:
+                option_coins = atoi(argv[i+1]);
+                break;
+            case COINRADIUS: // Change the pitch coin size.
+            case TINY_COINRADIUS:
+                option_coin_r = atof(argv[i+1]);
+                if(option_coin_r < 0.02f || option_coin_r > 0.5f)
+                {
+                    printf("WARNING: Invalid coin radius, valid range is 0.02 to 0.5.\n");
+                    option_coin_r = 0.3f;
+                }
+                break;
+            case PITCHFILE: // Load the pitch outline from a file.
+            case TINY_PITCHFILE:
+                option_pitch = argv[i+1];
+                break;
+            case THREADS: // Solve collisions in strips on this many threads.
+            case TINY_THREADS:
+                option_threads = atoi(argv[i+1]);
+                if(option_threads < 0 || option_threads > SOLVER_MAX_THREADS)
+                {
+                    printf("WARNING: Invalid thread count, valid range is 0 to %i.\n", SOLVER_MAX_THREADS);
+                    option_threads = 0;
+                }
+                break;
+            case FUZZ: // Fuzz the optimised solvers against the reference.
+            case TINY_FUZZ:
+                option_fuzz = atoi(argv[i+1]);
+                break;
+            case FUZZCASE: // Replay one fuzz case.
+            case TINY_FUZZCASE:
+                option_fuzz_case = argv[i+1];
+                break;
+            case TICKRATE: // Run the simulation at this many ticks a second.
+            case TINY_TICKRATE:
+                sim_hz = atoi(argv[i+1]);
+                if(sim_hz < 10 || sim_hz > 1000)
+                {
+                    printf("WARNING: Invalid tick rate, valid range is 10 to 1000.\n");
+                    sim_hz = SIM_HZ;
+                }
+                break;
+            case SIMULATE: // Play games headless.
+            case TINY_SIMULATE:
+                option_simulate = atoi(argv[i+1]);
+                break;
+            case SEED: // Seed the games --simulate plays.
+            case TINY_SEED:
+                option_seed = strtoul(argv[i+1], NULL, 10);
+                break;
+            case HEATMAP: // Tally where the coins go while simulating.
+            case TINY_HEATMAP:
+                option_heatmap = argv[i+1];
+                break;
+            case RECORDS: // Write every drop and game while simulating.
+            case TINY_RECORDS:
+                option_records = argv[i+1];
+                break;
+            case DETAIL: // Draw Tux this many levels of detail coarser.
+            case TINY_DETAIL:
+                lod_detail = atoi(argv[i+1]);
+                if(lod_detail < 0 || lod_detail > LOD_LEVELS-1)
+                {
+                    printf("WARNING: Invalid detail, valid range is 0 to %i.\n", LOD_LEVELS-1);
+                    lod_detail = 0;
+                }
+                break;
+        }
+    }
+
+    // the machine
+    if(option_pitch == NULL || pitchLoad(option_pitch) == 0)
+        pitchInit(pitch_default, sizeof(pitch_default)/sizeof(pvert));
+    if(tableInit(&tbl, option_coins, option_coin_r) == 0)
+    {
+        printf("ERROR: tableInit(): out of memory\n");
+        return 1;
+    }
+    if(option_simulate > 0)
+    {
+        if(option_layouts != NULL)
+            printf("WARNING: --layout-bank does not apply to --simulate, every game makes its own layout\n");
+        exit(batchRun(&tbl, option_simulate, option_threads, option_seed, option_heatmap, option_records) == 0 ? 0 : EXIT_FAILURE);
+    }
+    if(option_heatmap != NULL || option_records != NULL)
+        printf("WARNING: --heatmap and --records only apply to --simulate\n");
+
+    if(option_threads > 0 && solverInit(option_threads) == 0)
+        printf("WARNING: could not start the strip solver, using one thread\n");
+
+    if(option_fuzz > 0 || option_fuzz_case != NULL)
+        exit(fuzzRun(&tbl, option_fuzz, option_fuzz_case) == 0 ? 0 : EXIT_FAILURE);
+
+    if(option_make_layouts != NULL)
+    {
+        if(layoutBankSave(&tbl, option_make_layouts, option_make_count) == 0)
+        {
+            printf("ERROR: could not write %s\n", option_make_layouts);
+            exit(EXIT_FAILURE);
         }
+        printf("Wrote %i layouts to %s\n", option_make_count, option_make_layouts);
+        exit(0);
+    }
+
+    if(option_benchmark == 1)
+    {
+        newGame();
+        printf("==============================\n\n   -= Benchmark results =-\n\n");
+        printf("Collision Function: %i ns\n", BenchmarkFunction(benchStepCollisions, 512));
+        printf("Take Stack: %i ns\n", BenchmarkFunctionReset(benchTakeStack, benchResetTable, 512));
+        printf("inject Figures: %i ns\n", BenchmarkFunction(benchInjectFigure, 512));
+        printf("New Game Function: %i ns\n\n", BenchmarkFunction((void(*)())newGame, 16));
+        printf("Inside Pitch: %i ns\n", BenchmarkFunction((void(*)())insidePitch, 512));
+        printf("\n==============================\n");
+        exit(0);
     }
 
 #ifdef BUILD_GLFW
@@ -1545,74 +5595,47 @@ int main(int argc, char** argv)
     esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlPlane.iid, plane_indi, sizeof(plane_indi), GL_STATIC_DRAW);
 
     // ***** BIND SCENE *****
-    esBind(GL_ARRAY_BUFFER, &mdlScene.cid, scene_colors, sizeof(scene_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlScene.vid, scene_vertices, sizeof(scene_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlScene.nid, scene_normals, sizeof(scene_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlScene.iid, scene_indices, sizeof(scene_indices), GL_STATIC_DRAW);
+    meshBind(&mdlScene, NULL, NULL, scene_vertices, scene_normals, scene_colors, sizeof(scene_vertices), scene_indices, sizeof(scene_indices), sizeof(scene_indices[0]));
 
     // ***** BIND GAMEOVER *****
-    esBind(GL_ARRAY_BUFFER, &mdlGameover.vid, gameover_vertices, sizeof(gameover_vertices), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlGameover.iid, gameover_indices, sizeof(gameover_indices), GL_STATIC_DRAW);
+    meshBind(&mdlGameover, NULL, NULL, gameover_vertices, NULL, NULL, sizeof(gameover_vertices), gameover_indices, sizeof(gameover_indices), sizeof(gameover_indices[0]));
 
     // ***** BIND COIN *****
-    esBind(GL_ARRAY_BUFFER, &mdlCoin.cid, coin_colors, sizeof(coin_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlCoin.vid, coin_vertices, sizeof(coin_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlCoin.nid, coin_normals, sizeof(coin_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlCoin.iid, coin_indices, sizeof(coin_indices), GL_STATIC_DRAW);
+    meshBind(&mdlCoin, &meshCoin, NULL, coin_vertices, coin_normals, coin_colors, sizeof(coin_vertices), coin_indices, sizeof(coin_indices), sizeof(coin_indices[0]));
+    coinClasses(&mdlCoin, &meshCoin);
 
-    // ***** BIND COIN SILVER *****
-    esBind(GL_ARRAY_BUFFER, &mdlCoinSilver.cid, coin_silver_colors, sizeof(coin_silver_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlCoinSilver.vid, coin_silver_vertices, sizeof(coin_silver_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlCoinSilver.nid, coin_silver_normals, sizeof(coin_silver_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlCoinSilver.iid, coin_silver_indices, sizeof(coin_silver_indices), GL_STATIC_DRAW);
+    // ***** BIND COIN STACK *****
+    stackBind(&mdlStack, &meshCoin);
 
     // ***** BIND TUX *****
-    esBind(GL_ARRAY_BUFFER, &mdlTux.cid, tux_colors, sizeof(tux_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlTux.vid, tux_vertices, sizeof(tux_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlTux.nid, tux_normals, sizeof(tux_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlTux.iid, tux_indices, sizeof(tux_indices), GL_STATIC_DRAW);
+    meshBind(&mdlTux, NULL, &lodTux, tux_vertices, tux_normals, tux_colors, sizeof(tux_vertices), tux_indices, sizeof(tux_indices), sizeof(tux_indices[0]));
 
     // ***** BIND TUX - EVIL *****
-    esBind(GL_ARRAY_BUFFER, &mdlEvil.cid, evil_colors, sizeof(evil_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlEvil.vid, evil_vertices, sizeof(evil_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlEvil.nid, evil_normals, sizeof(evil_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlEvil.iid, evil_indices, sizeof(evil_indices), GL_STATIC_DRAW);
+    meshBind(&mdlEvil, NULL, &lodEvil, evil_vertices, evil_normals, evil_colors, sizeof(evil_vertices), evil_indices, sizeof(evil_indices), sizeof(evil_indices[0]));
 
     // ***** BIND TUX - KING *****
-    esBind(GL_ARRAY_BUFFER, &mdlKing.cid, king_colors, sizeof(king_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlKing.vid, king_vertices, sizeof(king_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlKing.nid, king_normals, sizeof(king_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlKing.iid, king_indices, sizeof(king_indices), GL_STATIC_DRAW);
+    meshBind(&mdlKing, NULL, &lodKing, king_vertices, king_normals, king_colors, sizeof(king_vertices), king_indices, sizeof(king_indices), sizeof(king_indices[0]));
 
     // ***** BIND TUX - NINJA *****
-    esBind(GL_ARRAY_BUFFER, &mdlNinja.cid, ninja_colors, sizeof(ninja_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlNinja.vid, ninja_vertices, sizeof(ninja_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlNinja.nid, ninja_normals, sizeof(ninja_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlNinja.iid, ninja_indices, sizeof(ninja_indices), GL_STATIC_DRAW);
+    meshBind(&mdlNinja, NULL, &lodNinja, ninja_vertices, ninja_normals, ninja_colors, sizeof(ninja_vertices), ninja_indices, sizeof(ninja_indices), sizeof(ninja_indices[0]));
 
     // ***** BIND TUX - SURF *****
-    esBind(GL_ARRAY_BUFFER, &mdlSurf.cid, surf_colors, sizeof(surf_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlSurf.vid, surf_vertices, sizeof(surf_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlSurf.nid, surf_normals, sizeof(surf_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlSurf.iid, surf_indices, sizeof(surf_indices), GL_STATIC_DRAW);
+    meshBind(&mdlSurf, NULL, &lodSurf, surf_vertices, surf_normals, surf_colors, sizeof(surf_vertices), surf_indices, sizeof(surf_indices), sizeof(surf_indices[0]));
 
     // ***** BIND TUX - TRIP *****
-    esBind(GL_ARRAY_BUFFER, &mdlTrip.cid, trip_colors, sizeof(trip_colors), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlTrip.vid, trip_vertices, sizeof(trip_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlTrip.nid, trip_normals, sizeof(trip_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlTrip.iid, trip_indices, sizeof(trip_indices), GL_STATIC_DRAW);
+    meshBind(&mdlTrip, NULL, &lodTrip, trip_vertices, trip_normals, trip_colors, sizeof(trip_vertices), trip_indices, sizeof(trip_indices), sizeof(trip_indices[0]));
 
     // ***** BIND SCENE PROP - RED X *****
-    esBind(GL_ARRAY_BUFFER, &mdlRX.vid, rx_vertices, sizeof(rx_vertices), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRX.iid, rx_indices, sizeof(rx_indices), GL_STATIC_DRAW);
+    meshBind(&mdlRX, NULL, NULL, rx_vertices, NULL, NULL, sizeof(rx_vertices), rx_indices, sizeof(rx_indices), sizeof(rx_indices[0]));
 
     // ***** BIND SCENE PROP - SILVER ARROW *****
-    esBind(GL_ARRAY_BUFFER, &mdlSA.vid, sa_vertices, sizeof(sa_vertices), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlSA.iid, sa_indices, sizeof(sa_indices), GL_STATIC_DRAW);
+    meshBind(&mdlSA, NULL, NULL, sa_vertices, NULL, NULL, sizeof(sa_vertices), sa_indices, sizeof(sa_indices), sizeof(sa_indices[0]));
 
     // ***** BIND SCENE PROP - GOLD ARROW *****
-    esBind(GL_ARRAY_BUFFER, &mdlGA.vid, ga_vertices, sizeof(ga_vertices), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlGA.iid, ga_indices, sizeof(ga_indices), GL_STATIC_DRAW);
+    meshBind(&mdlGA, NULL, NULL, ga_vertices, NULL, NULL, sizeof(ga_vertices), ga_indices, sizeof(ga_indices), sizeof(ga_indices[0]));
+
+    printf("Meshes: %u vertices welded to %u, ACMR %.2f optimised to %.2f\n", mesh_stats.verts, mesh_stats.welded,
+           (f32)mesh_stats.miss / mesh_stats.tris, (f32)mesh_stats.opt_miss / mesh_stats.tris);
 
 //*************************************
 // compile & link shader program
@@ -1620,6 +5643,29 @@ int main(int argc, char** argv)
 
     makeFullbright();
     makeLambert3();
+    makeLambert3i();
+    if(shdLambert3i == 0){coinSilver();}
+    instInit();
+    cbInit();
+
+//*************************************
+// vertex array objects
+//*************************************
+
+    if(vaoInit() == 1)
+    {
+        ESModel* m3[] = {&mdlScene, &mdlCoin, &mdlStack, &mdlTux, &mdlEvil, &mdlKing, &mdlSurf, &mdlNinja, &mdlTrip};
+        ESModel* m1[] = {&mdlPlane, &mdlGameover, &mdlRX, &mdlSA, &mdlGA};
+        for(unsigned int i=0; i < sizeof(m3)/sizeof(ESModel*); i++)
+            vaoMake(m3[i], 3);
+        for(unsigned int i=0; i < sizeof(m1)/sizeof(ESModel*); i++)
+            vaoMake(m1[i], 1);
+        if(mdlSilver[0].vid != 0)
+        {
+            vaoMake(&mdlSilver[0], 3);
+            vaoMake(&mdlSilver[1], 3);
+        }
+    }
 
 //*************************************
 // configure render options
@@ -1629,6 +5675,7 @@ int main(int argc, char** argv)
     glEnable(GL_DEPTH_TEST);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glClearColor(0.52941f, 0.80784f, 0.92157f, 0.0f);
+    gsReset(); // the loaders above set state behind the cache
 
 //*************************************
 // execute update / render loop
@@ -1642,7 +5689,13 @@ int main(int argc, char** argv)
 #endif
 
     // new game
+    layoutBankInit(&tbl, option_layouts);
     newGame();
+    if(simStart() == 0)
+    {
+        printf("ERROR: simulation thread failed to start\n");
+        return 1;
+    }
     
     // init
     t = f32Time();